@@ -0,0 +1,561 @@
+#ifndef AISDI_LINEAR_BITVECTOR_H
+#define AISDI_LINEAR_BITVECTOR_H
+
+#define INIT_BIT_WORDS 1
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+// Vector of flags packed 64 to a machine word. Shifting (insert, erase),
+// counting and searching work on whole words. Bits past getSize() are
+// always kept clear, so word-level operations need no masking.
+class BitVector
+{
+  private:
+    using Word = std::uint64_t;
+    static const std::size_t wordBits = 64;
+
+    std::size_t size;
+    std::size_t wordCapacity;
+    Word *words;
+
+    static std::size_t wordsFor(std::size_t bits)
+    {
+        return (bits + wordBits - 1) / wordBits;
+    }
+
+    static Word lowMask(std::size_t count)
+    {
+        return count >= wordBits ? ~Word(0) : (Word(1) << count) - 1;
+    }
+
+    void increaseSize(std::size_t requiredBits)
+    {
+        std::size_t newCapacity = wordCapacity ? wordCapacity : INIT_BIT_WORDS;
+        while (newCapacity * wordBits < requiredBits)
+            newCapacity = newCapacity << 1;
+
+        Word *newWords = new Word[newCapacity]();
+        for (std::size_t i = 0; i < wordCapacity; ++i)
+            newWords[i] = words[i];
+
+        delete [] words;
+        words = newWords;
+        wordCapacity = newCapacity;
+    }
+
+    bool getBit(std::size_t index) const
+    {
+        return (words[index / wordBits] >> (index % wordBits)) & 1;
+    }
+
+    void setBit(std::size_t index, bool value)
+    {
+        Word bit = Word(1) << (index % wordBits);
+        if (value)
+            words[index / wordBits] |= bit;
+        else
+            words[index / wordBits] &= ~bit;
+    }
+
+    // reads count <= 64 bits starting at position, possibly from two words
+    Word readBits(std::size_t position, std::size_t count) const
+    {
+        std::size_t word = position / wordBits;
+        std::size_t shift = position % wordBits;
+        Word bits = words[word] >> shift;
+        if (shift != 0 && shift + count > wordBits)
+            bits |= words[word + 1] << (wordBits - shift);
+        return bits & lowMask(count);
+    }
+
+    void writeBits(std::size_t position, Word bits, std::size_t count)
+    {
+        std::size_t word = position / wordBits;
+        std::size_t shift = position % wordBits;
+        Word mask = lowMask(count);
+        words[word] = (words[word] & ~(mask << shift)) | ((bits & mask) << shift);
+        if (shift != 0 && shift + count > wordBits)
+        {
+            std::size_t spilled = wordBits - shift;
+            words[word + 1] = (words[word + 1] & ~(mask >> spilled)) | ((bits & mask) >> spilled);
+        }
+    }
+
+    // memmove for bits, a word at a time
+    void moveBits(std::size_t from, std::size_t to, std::size_t count)
+    {
+        if (to < from)
+        {
+            for (std::size_t done = 0; done < count; done += wordBits)
+            {
+                std::size_t chunk = count - done < wordBits ? count - done : wordBits;
+                writeBits(to + done, readBits(from + done, chunk), chunk);
+            }
+        }
+        else if (to > from)
+        {
+            for (std::size_t left = count; left > 0;)
+            {
+                std::size_t chunk = left < wordBits ? left : wordBits;
+                left -= chunk;
+                writeBits(to + left, readBits(from + left, chunk), chunk);
+            }
+        }
+    }
+
+    void insertAt(std::size_t index, bool value)
+    {
+        if (size == wordCapacity * wordBits)
+            increaseSize(size + 1);
+
+        moveBits(index, index + 1, size - index);
+        setBit(index, value);
+        ++size;
+    }
+
+    void eraseAt(std::size_t index, std::size_t count)
+    {
+        moveBits(index + count, index, size - index - count);
+        for (std::size_t cleared = 0; cleared < count; cleared += wordBits)
+        {
+            std::size_t chunk = count - cleared < wordBits ? count - cleared : wordBits;
+            writeBits(size - count + cleared, 0, chunk);
+        }
+        size -= count;
+    }
+
+    template <typename Operation>
+    void combine(const BitVector &other, Operation operation)
+    {
+        if (size != other.size)
+            throw std::invalid_argument("Bit vectors differ in size");
+
+        for (std::size_t i = 0; i < wordsFor(size); ++i)
+            words[i] = operation(words[i], other.words[i]);
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = bool;
+    using const_reference = bool;
+
+    class Reference;
+    class ConstIterator;
+    class Iterator;
+    using reference = Reference;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    BitVector() : size(0), wordCapacity(0), words(nullptr) {}
+
+    BitVector(size_type count, bool value) : BitVector()
+    {
+        increaseSize(count);
+        for (size_type i = 0; i < count; ++i)
+            append(value);
+    }
+
+    BitVector(std::initializer_list<bool> l) : BitVector()
+    {
+        for (bool el : l)
+            append(el);
+    }
+
+    BitVector(const BitVector &other) : BitVector()
+    {
+        *this = other;
+    }
+
+    BitVector(BitVector &&other) : BitVector()
+    {
+        *this = std::move(other);
+    }
+
+    ~BitVector()
+    {
+        delete [] words;
+    }
+
+    BitVector &operator=(const BitVector &other)
+    {
+        if (this != &other)
+        {
+            if (wordCapacity * wordBits < other.size)
+                increaseSize(other.size);
+
+            for (std::size_t i = 0; i < wordCapacity; ++i)
+                words[i] = i < wordsFor(other.size) ? other.words[i] : 0;
+            size = other.size;
+        }
+
+        return *this;
+    }
+
+    BitVector &operator=(BitVector &&other)
+    {
+        if (this != &other)
+        {
+            delete [] words;
+
+            size = other.size;
+            wordCapacity = other.wordCapacity;
+            words = other.words;
+
+            other.size = 0;
+            other.wordCapacity = 0;
+            other.words = nullptr;
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    void append(bool value)
+    {
+        insertAt(size, value);
+    }
+
+    void prepend(bool value)
+    {
+        insertAt(0, value);
+    }
+
+    void insert(const const_iterator &insertPosition, bool value);
+
+    bool popFirst()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        bool ret = getBit(0);
+        eraseAt(0, 1);
+        return ret;
+    }
+
+    bool popLast()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        bool ret = getBit(size - 1);
+        eraseAt(size - 1, 1);
+        return ret;
+    }
+
+    void erase(const const_iterator &position);
+
+    void erase(const const_iterator &firstIncluded,
+               const const_iterator &nextExcluded);
+
+    reference operator[](size_type index);
+
+    bool operator[](size_type index) const
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return getBit(index);
+    }
+
+    // number of set flags
+    size_type popcount() const
+    {
+        size_type count = 0;
+        for (std::size_t i = 0; i < wordsFor(size); ++i)
+            count += std::popcount(words[i]);
+        return count;
+    }
+
+    // Index of the first set flag not before from, getSize() if there is none.
+    size_type findFirstSet(size_type from = 0) const
+    {
+        if (from >= size)
+            return size;
+
+        std::size_t word = from / wordBits;
+        Word bits = words[word] & (~Word(0) << (from % wordBits));
+        while (bits == 0)
+        {
+            if (++word == wordsFor(size))
+                return size;
+            bits = words[word];
+        }
+
+        return word * wordBits + std::countr_zero(bits);
+    }
+
+    BitVector &operator&=(const BitVector &other)
+    {
+        combine(other, [](Word a, Word b) { return a & b; });
+        return *this;
+    }
+
+    BitVector &operator|=(const BitVector &other)
+    {
+        combine(other, [](Word a, Word b) { return a | b; });
+        return *this;
+    }
+
+    BitVector &operator^=(const BitVector &other)
+    {
+        combine(other, [](Word a, Word b) { return a ^ b; });
+        return *this;
+    }
+
+    iterator begin();
+    iterator end();
+
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+};
+
+// Stands in for bool& to a single packed flag.
+class BitVector::Reference
+{
+  private:
+    BitVector *vector;
+    std::size_t index;
+
+  public:
+    explicit Reference(BitVector *vector, std::size_t index) : vector(vector), index(index) {}
+
+    operator bool() const
+    {
+        return vector->getBit(index);
+    }
+
+    Reference &operator=(bool value)
+    {
+        vector->setBit(index, value);
+        return *this;
+    }
+
+    Reference &operator=(const Reference &other)
+    {
+        return *this = static_cast<bool>(other);
+    }
+};
+
+class BitVector::ConstIterator
+{
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = bool;
+    using difference_type = BitVector::difference_type;
+    using pointer = void;
+    using reference = bool;
+
+    const BitVector *vector;
+    std::size_t index;
+
+    explicit ConstIterator(const BitVector *vector, std::size_t index) : vector(vector), index(index)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        return vector->getBit(index);
+    }
+
+    ConstIterator &operator++()
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("The next iterator does not exist");
+
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(vector, index);
+        ++(*this);
+        return tmp;
+    }
+
+    ConstIterator &operator--()
+    {
+        if (index == 0)
+            throw std::out_of_range("The previous iterator does not exist");
+
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator tmp(vector, index);
+        --(*this);
+        return tmp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        difference_type distToNext = vector->size - index;
+        if (d > distToNext)
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        if (d > static_cast<difference_type>(index))
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index - d);
+    }
+
+    bool operator==(const ConstIterator &other) const
+    {
+        return vector == other.vector && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+class BitVector::Iterator : public BitVector::ConstIterator
+{
+  public:
+    using reference = BitVector::reference;
+
+    explicit Iterator(BitVector *vector, std::size_t index) : ConstIterator(vector, index) {}
+
+    Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+    Iterator &operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator &operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        // ugly cast, yet reduces code duplication.
+        return Reference(const_cast<BitVector *>(vector), index);
+    }
+};
+
+inline void BitVector::insert(const const_iterator &insertPosition, bool value)
+{
+    insertAt(insertPosition.index, value);
+}
+
+inline void BitVector::erase(const const_iterator &position)
+{
+    if (isEmpty() || position.index >= size)
+        throw std::out_of_range("Position out of range");
+
+    eraseAt(position.index, 1);
+}
+
+inline void BitVector::erase(const const_iterator &firstIncluded,
+                             const const_iterator &nextExcluded)
+{
+    if (isEmpty())
+        throw std::out_of_range("Collection already empty");
+
+    eraseAt(firstIncluded.index, nextExcluded.index - firstIncluded.index);
+}
+
+inline BitVector::reference BitVector::operator[](size_type index)
+{
+    if (index >= size)
+        throw std::out_of_range("Index out of range");
+
+    return Reference(this, index);
+}
+
+inline BitVector::iterator BitVector::begin()
+{
+    return iterator(this, 0);
+}
+
+inline BitVector::iterator BitVector::end()
+{
+    return iterator(this, size);
+}
+
+inline BitVector::const_iterator BitVector::cbegin() const
+{
+    return const_iterator(this, 0);
+}
+
+inline BitVector::const_iterator BitVector::cend() const
+{
+    return const_iterator(this, size);
+}
+
+inline BitVector::const_iterator BitVector::begin() const
+{
+    return cbegin();
+}
+
+inline BitVector::const_iterator BitVector::end() const
+{
+    return cend();
+}
+}
+
+#endif // AISDI_LINEAR_BITVECTOR_H
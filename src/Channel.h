@@ -0,0 +1,339 @@
+#ifndef AISDI_LINEAR_CHANNEL_H
+#define AISDI_LINEAR_CHANNEL_H
+
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "IntrusiveList.h"
+#include "LinkedList.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+// Resumes a woken coroutine. Wake-ups made while another woken coroutine
+// runs on this thread are queued and resumed after it suspends, by the
+// outermost call, so hand-offs between coroutines do not nest stack frames.
+inline void resumeWoken(std::coroutine_handle<> handle)
+{
+    struct ReadyQueue
+    {
+        Vector<std::coroutine_handle<>> handles;
+        std::size_t first = 0;
+        bool draining = false;
+    };
+    thread_local ReadyQueue ready;
+
+    ready.handles.append(handle);
+    if (ready.draining)
+        return;
+
+    ready.draining = true;
+    try
+    {
+        while (ready.first < ready.handles.getSize())
+        {
+            std::coroutine_handle<> next = ready.handles[ready.first++];
+            next.resume();
+        }
+    }
+    catch (...)
+    {
+        // the rest is left for the next wake-up on this thread
+        ready.draining = false;
+        throw;
+    }
+
+    while (!ready.handles.isEmpty())
+        ready.handles.popLast();
+    ready.first = 0;
+    ready.draining = false;
+}
+
+// Channel between coroutines: co_await send(item) and co_await receive().
+// Items are queued in a LinkedList; a coroutine that has to wait links its
+// awaiter (which lives in the coroutine frame) into an IntrusiveList, so
+// waiting does not allocate. Woken coroutines are resumed on the thread that
+// woke them, through resumeWoken. Nobody may still be waiting when the
+// channel is destroyed.
+template <typename Type>
+class Channel
+{
+  public:
+    class SendAwaiter
+    {
+      private:
+        friend class Channel;
+
+        Channel &channel;
+        Type item;
+        std::coroutine_handle<> handle;
+        bool closed;
+
+      public:
+        IntrusiveListHook hook;
+
+        SendAwaiter(Channel &channel, const Type &item) : channel(channel), item(item), closed(false) {}
+
+        SendAwaiter(Channel &channel, Type &&item) : channel(channel), item(std::move(item)), closed(false) {}
+
+        SendAwaiter(const SendAwaiter &other) = delete;
+        SendAwaiter &operator=(const SendAwaiter &other) = delete;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> caller)
+        {
+            return channel.suspendSender(*this, caller);
+        }
+
+        void await_resume() const
+        {
+            if (closed)
+                throw std::logic_error("Channel already closed");
+        }
+    };
+
+  private:
+    class Receiver
+    {
+      private:
+        friend class Channel;
+
+        Channel &channel;
+        std::size_t maxCount;
+        std::coroutine_handle<> handle;
+
+      protected:
+        std::optional<Type> item;
+        Vector<Type> *batch;
+
+        Receiver(Channel &channel, std::size_t maxCount, Vector<Type> *batch)
+            : channel(channel), maxCount(maxCount), batch(batch)
+        {
+        }
+
+        std::size_t received() const
+        {
+            return batch ? batch->getSize() : (item ? 1 : 0);
+        }
+
+        void deliver(Type &&value)
+        {
+            if (batch)
+                batch->append(std::move(value));
+            else
+                item.emplace(std::move(value));
+        }
+
+      public:
+        IntrusiveListHook hook;
+
+        Receiver(const Receiver &other) = delete;
+        Receiver &operator=(const Receiver &other) = delete;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> caller)
+        {
+            return channel.suspendReceiver(*this, caller);
+        }
+    };
+
+  public:
+    class ReceiveAwaiter : public Receiver
+    {
+      public:
+        explicit ReceiveAwaiter(Channel &channel) : Receiver(channel, 1, nullptr) {}
+
+        std::optional<Type> await_resume()
+        {
+            return std::move(this->item);
+        }
+    };
+
+    class BatchReceiveAwaiter : public Receiver
+    {
+      private:
+        Vector<Type> items;
+
+      public:
+        BatchReceiveAwaiter(Channel &channel, std::size_t maxCount) : Receiver(channel, maxCount, &items)
+        {
+            if (maxCount == 0)
+                throw std::invalid_argument("Batch has to hold at least one item");
+        }
+
+        Vector<Type> await_resume()
+        {
+            return std::move(items);
+        }
+    };
+
+  private:
+    using Senders = IntrusiveList<SendAwaiter, &SendAwaiter::hook>;
+    using Receivers = IntrusiveList<Receiver, &Receiver::hook>;
+
+    std::mutex lock;
+    LinkedList<Type> buffer;
+    Senders senders;
+    Receivers receivers;
+    std::size_t capacity;
+    bool closed;
+
+    bool hasRoom() const
+    {
+        return capacity == 0 || buffer.getSize() < capacity;
+    }
+
+    bool suspendSender(SendAwaiter &sender, std::coroutine_handle<> caller)
+    {
+        Receiver *receiver = nullptr;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (closed)
+            {
+                sender.closed = true;
+                return false;
+            }
+
+            if (!receivers.isEmpty())
+            {
+                // a waiting receiver means the buffer is empty, hand over directly
+                receiver = &receivers.popFirst();
+                receiver->deliver(std::move(sender.item));
+            }
+            else if (hasRoom())
+            {
+                buffer.append(sender.item);
+            }
+            else
+            {
+                sender.handle = caller;
+                senders.append(sender);
+                return true;
+            }
+        }
+
+        if (receiver)
+            resumeWoken(receiver->handle);
+        return false;
+    }
+
+    bool suspendReceiver(Receiver &receiver, std::coroutine_handle<> caller)
+    {
+        Senders wokenSenders;
+        bool suspend = false;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            while (receiver.received() < receiver.maxCount && !buffer.isEmpty())
+                receiver.deliver(buffer.popFirst());
+
+            // senders blocked on a full buffer can now move their items in
+            while (!senders.isEmpty() && hasRoom())
+            {
+                SendAwaiter &sender = senders.popFirst();
+                buffer.append(sender.item);
+                wokenSenders.append(sender);
+            }
+
+            if (receiver.received() == 0 && !closed)
+            {
+                receiver.handle = caller;
+                receivers.append(receiver);
+                suspend = true;
+            }
+        }
+
+        while (!wokenSenders.isEmpty())
+            resumeWoken(wokenSenders.popFirst().handle);
+        return suspend;
+    }
+
+  public:
+    using size_type = std::size_t;
+    using value_type = Type;
+
+    Channel() : capacity(0), closed(false) {}
+
+    explicit Channel(size_type capacity) : capacity(capacity), closed(false)
+    {
+        if (capacity == 0)
+            throw std::invalid_argument("Bounded channel needs a positive capacity");
+    }
+
+    Channel(const Channel &other) = delete;
+    Channel &operator=(const Channel &other) = delete;
+
+    bool isClosed()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return closed;
+    }
+
+    size_type getSize()
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        return buffer.getSize();
+    }
+
+    // Waiting senders fail with std::logic_error, receivers get the queued
+    // items first and then nothing.
+    void close()
+    {
+        Senders wokenSenders;
+        Receivers wokenReceivers;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            closed = true;
+            wokenSenders = std::move(senders);
+            wokenReceivers = std::move(receivers);
+        }
+
+        while (!wokenSenders.isEmpty())
+        {
+            SendAwaiter &sender = wokenSenders.popFirst();
+            sender.closed = true;
+            resumeWoken(sender.handle);
+        }
+
+        while (!wokenReceivers.isEmpty())
+            resumeWoken(wokenReceivers.popFirst().handle);
+    }
+
+    SendAwaiter send(const Type &item)
+    {
+        return SendAwaiter(*this, item);
+    }
+
+    SendAwaiter send(Type &&item)
+    {
+        return SendAwaiter(*this, std::move(item));
+    }
+
+    // Yields an empty optional once the channel is closed and drained.
+    ReceiveAwaiter receive()
+    {
+        return ReceiveAwaiter(*this);
+    }
+
+    // Waits for at least one item and takes up to maxCount of them at once.
+    // Yields an empty Vector once the channel is closed and drained.
+    BatchReceiveAwaiter receiveBatch(size_type maxCount)
+    {
+        return BatchReceiveAwaiter(*this, maxCount);
+    }
+};
+}
+
+#endif // AISDI_LINEAR_CHANNEL_H
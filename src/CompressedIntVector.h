@@ -0,0 +1,329 @@
+#ifndef AISDI_LINEAR_COMPRESSEDINTVECTOR_H
+#define AISDI_LINEAR_COMPRESSEDINTVECTOR_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi
+{
+
+// Append-only vector of integers compressed in blocks of BlockSize values.
+// A full block is packed in just as many bits per value as its largest
+// number needs, using whichever encoding is narrower for that block: frame
+// of reference (the distance of every value from the block minimum) or
+// delta (the difference from the previous value, with a prefix sum to
+// decode). Sorted IDs and timestamps with small gaps take the delta form
+// and mostly need 8-16 bits instead of 64. The block being filled is kept
+// uncompressed.
+template <typename Type, std::size_t BlockSize = 128>
+class CompressedIntVector
+{
+    static_assert(std::is_integral<Type>::value && sizeof(Type) <= 8,
+                  "CompressedIntVector stores integers of at most 64 bits");
+    static_assert(BlockSize > 0, "Blocks have to hold at least one value");
+
+  private:
+    using Word = std::uint64_t;
+    using Unsigned = std::make_unsigned_t<Type>;
+    static const std::size_t wordBits = 64;
+
+    // reference is the minimum, or the first value of a delta block
+    struct Block
+    {
+        Type reference;
+        std::size_t width;
+        std::size_t firstWord;
+        bool delta;
+    };
+
+    std::size_t size;
+    Block *blocks;
+    std::size_t blockCount;
+    std::size_t blockCapacity;
+    Word *words;
+    std::size_t wordCount;
+    std::size_t wordCapacity;
+    Type pending[BlockSize];
+
+    static Word lowMask(std::size_t count)
+    {
+        return count >= wordBits ? ~Word(0) : (Word(1) << count) - 1;
+    }
+
+    template <typename Item>
+    static void reserve(Item *&items, std::size_t count, std::size_t &capacity, std::size_t required)
+    {
+        if (required <= capacity)
+            return;
+
+        std::size_t newCapacity = capacity ? capacity : 16;
+        while (newCapacity < required)
+            newCapacity = newCapacity << 1;
+
+        Item *newItems = new Item[newCapacity]();
+        for (std::size_t i = 0; i < count; ++i)
+            newItems[i] = items[i];
+
+        delete [] items;
+        items = newItems;
+        capacity = newCapacity;
+    }
+
+    // Always reads the following word too, so that there is no branch on
+    // whether the value straddles two words: a zero word is kept after the
+    // last block. Shifting in two steps keeps the shift below 64 when
+    // shift is 0.
+    static Word unpack(const Word *packed, std::size_t width, std::size_t position)
+    {
+        std::size_t bit = position * width;
+        std::size_t word = bit / wordBits;
+        std::size_t shift = bit % wordBits;
+        Word value = (packed[word] >> shift) | ((packed[word + 1] << 1) << (wordBits - 1 - shift));
+        return value & lowMask(width);
+    }
+
+    static Word distance(Type from, Type to)
+    {
+        return static_cast<Word>(Unsigned(Unsigned(to) - Unsigned(from)));
+    }
+
+    // number stored for value i of the pending block
+    Word encoded(const Block &block, std::size_t i) const
+    {
+        if (block.delta)
+            return i == 0 ? 0 : distance(pending[i - 1], pending[i]);
+        return distance(block.reference, pending[i]);
+    }
+
+    // packs the pending values into a new block
+    void seal()
+    {
+        Type minimum = pending[0];
+        Type maximum = pending[0];
+        Word largestDelta = 0;
+        for (std::size_t i = 1; i < BlockSize; ++i)
+        {
+            if (pending[i] < minimum)
+                minimum = pending[i];
+            if (maximum < pending[i])
+                maximum = pending[i];
+            if (largestDelta < distance(pending[i - 1], pending[i]))
+                largestDelta = distance(pending[i - 1], pending[i]);
+        }
+
+        std::size_t referenceWidth = std::bit_width(distance(minimum, maximum));
+        std::size_t deltaWidth = std::bit_width(largestDelta);
+        Block block = deltaWidth < referenceWidth ? Block{ pending[0], deltaWidth, wordCount, true }
+                                                  : Block{ minimum, referenceWidth, wordCount, false };
+
+        std::size_t blockWords = (BlockSize * block.width + wordBits - 1) / wordBits;
+        reserve(blocks, blockCount, blockCapacity, blockCount + 1);
+        reserve(words, wordCount, wordCapacity, wordCount + blockWords + 1);
+
+        Word *packed = words + wordCount;
+        for (std::size_t i = 0; i < BlockSize && block.width > 0; ++i)
+        {
+            Word number = encoded(block, i);
+            std::size_t bit = i * block.width;
+            std::size_t shift = bit % wordBits;
+            packed[bit / wordBits] |= number << shift;
+            if (shift + block.width > wordBits)
+                packed[bit / wordBits + 1] |= number >> (wordBits - shift);
+        }
+
+        blocks[blockCount++] = block;
+        wordCount += blockWords;
+    }
+
+  public:
+    using size_type = std::size_t;
+    using value_type = Type;
+
+    CompressedIntVector() : size(0), blocks(nullptr), blockCount(0), blockCapacity(0), words(nullptr),
+        wordCount(0), wordCapacity(0), pending()
+    {
+    }
+
+    CompressedIntVector(std::initializer_list<Type> l) : CompressedIntVector()
+    {
+        for (Type el : l)
+            append(el);
+    }
+
+    CompressedIntVector(const CompressedIntVector &other) : CompressedIntVector()
+    {
+        *this = other;
+    }
+
+    CompressedIntVector(CompressedIntVector &&other) : CompressedIntVector()
+    {
+        *this = std::move(other);
+    }
+
+    ~CompressedIntVector()
+    {
+        delete [] blocks;
+        delete [] words;
+    }
+
+    CompressedIntVector &operator=(const CompressedIntVector &other)
+    {
+        if (this != &other)
+        {
+            blockCount = 0;
+            wordCount = 0;
+            reserve(blocks, blockCount, blockCapacity, other.blockCount);
+            reserve(words, wordCount, wordCapacity, other.wordCount + 1);
+
+            for (std::size_t i = 0; i < other.blockCount; ++i)
+                blocks[i] = other.blocks[i];
+            for (std::size_t i = 0; i < wordCapacity; ++i)
+                words[i] = i < other.wordCount ? other.words[i] : 0;
+            for (std::size_t i = 0; i < BlockSize; ++i)
+                pending[i] = other.pending[i];
+
+            size = other.size;
+            blockCount = other.blockCount;
+            wordCount = other.wordCount;
+        }
+
+        return *this;
+    }
+
+    CompressedIntVector &operator=(CompressedIntVector &&other)
+    {
+        if (this != &other)
+        {
+            std::swap(size, other.size);
+            std::swap(blocks, other.blocks);
+            std::swap(blockCount, other.blockCount);
+            std::swap(blockCapacity, other.blockCapacity);
+            std::swap(words, other.words);
+            std::swap(wordCount, other.wordCount);
+            std::swap(wordCapacity, other.wordCapacity);
+            std::swap(pending, other.pending);
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    // number of blocks, counting the one being filled
+    size_type getBlockCount() const
+    {
+        return blockCount + (size % BlockSize != 0 ? 1 : 0);
+    }
+
+    // memory taken by the packed values and block headers
+    size_type getCompressedBytes() const
+    {
+        return wordCount * sizeof(Word) + blockCount * sizeof(Block);
+    }
+
+    void append(Type value)
+    {
+        pending[size % BlockSize] = value;
+        ++size;
+        if (size % BlockSize == 0)
+            seal();
+    }
+
+    Type operator[](size_type index) const
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        std::size_t blockIndex = index / BlockSize;
+        if (blockIndex == blockCount)
+            return pending[index % BlockSize];
+
+        const Block &block = blocks[blockIndex];
+        if (block.width == 0)
+            return block.reference;
+
+        // a delta block sums the differences up to the value
+        const Word *packed = words + block.firstWord;
+        Unsigned value = Unsigned(block.reference);
+        if (block.delta)
+        {
+            for (std::size_t i = 1; i <= index % BlockSize; ++i)
+                value = Unsigned(value + Unsigned(unpack(packed, block.width, i)));
+        }
+        else
+            value = Unsigned(value + Unsigned(unpack(packed, block.width, index % BlockSize)));
+
+        return Type(value);
+    }
+
+    // Decodes a whole block into out, which has room for BlockSize values,
+    // and returns how many values were written.
+    size_type decodeBlock(size_type blockIndex, Type *out) const
+    {
+        if (blockIndex >= getBlockCount())
+            throw std::out_of_range("Block index out of range");
+
+        if (blockIndex == blockCount)
+        {
+            for (std::size_t i = 0; i < size % BlockSize; ++i)
+                out[i] = pending[i];
+            return size % BlockSize;
+        }
+
+        // Fixed width loops without branches on the values; only the frame
+        // of reference one is independent per value, the prefix sum of a
+        // delta block is serial.
+        const Block &block = blocks[blockIndex];
+        const Word *packed = words + block.firstWord;
+        Unsigned reference = Unsigned(block.reference);
+        if (block.width == 0)
+        {
+            for (std::size_t i = 0; i < BlockSize; ++i)
+                out[i] = block.reference;
+        }
+        else if (block.delta)
+        {
+            for (std::size_t i = 0; i < BlockSize; ++i)
+            {
+                reference = Unsigned(reference + Unsigned(unpack(packed, block.width, i)));
+                out[i] = Type(reference);
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < BlockSize; ++i)
+                out[i] = Type(reference + Unsigned(unpack(packed, block.width, i)));
+        }
+
+        return BlockSize;
+    }
+
+    // Calls f for every value in order, decoding one block at a time.
+    template <typename Function>
+    void forEach(Function f) const
+    {
+        Type decoded[BlockSize];
+        for (std::size_t b = 0; b < getBlockCount(); ++b)
+        {
+            std::size_t count = decodeBlock(b, decoded);
+            for (std::size_t i = 0; i < count; ++i)
+                f(decoded[i]);
+        }
+    }
+};
+}
+
+#endif // AISDI_LINEAR_COMPRESSEDINTVECTOR_H
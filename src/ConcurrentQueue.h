@@ -0,0 +1,231 @@
+#ifndef AISDI_LINEAR_CONCURRENTQUEUE_H
+#define AISDI_LINEAR_CONCURRENTQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#include "EpochReclamation.h"
+
+namespace aisdi
+{
+
+// Lock-free multi-producer multi-consumer FIFO queue (Michael & Scott).
+// Unlinked nodes go through epoch-based reclamation and are then recycled
+// by a lock-free node pool instead of being returned to the allocator.
+template <typename Type>
+class ConcurrentQueue
+{
+  private:
+    class Node;
+
+    EpochReclamation epoch;
+    alignas(64) std::atomic<Node *> head;
+    alignas(64) std::atomic<Node *> tail;
+    alignas(64) std::atomic<Node *> pool;
+
+    // has to be called inside a guard, which rules out ABA on the pool
+    Node *allocate()
+    {
+        Node *ptr = pool.load(std::memory_order_acquire);
+        while (ptr && !pool.compare_exchange_weak(ptr, ptr->next.load(std::memory_order_relaxed),
+                                                  std::memory_order_acquire))
+        {
+        }
+
+        if (!ptr)
+            ptr = new Node();
+
+        ptr->next.store(nullptr, std::memory_order_relaxed);
+        return ptr;
+    }
+
+    void pushToPool(Node *ptr)
+    {
+        Node *top = pool.load(std::memory_order_relaxed);
+        do
+            ptr->next.store(top, std::memory_order_relaxed);
+        while (!pool.compare_exchange_weak(top, ptr, std::memory_order_release,
+                                           std::memory_order_relaxed));
+    }
+
+    void recycle(EpochReclamation::Retired *chain)
+    {
+        while (chain)
+        {
+            Node *ptr = static_cast<Node *>(chain);
+            chain = chain->retiredNext;
+            pushToPool(ptr);
+        }
+    }
+
+    template <typename Consumer>
+    bool consumeFirst(Consumer consume)
+    {
+        EpochReclamation::Guard guard(epoch);
+
+        for (;;)
+        {
+            Node *first = head.load(std::memory_order_acquire);
+            Node *last = tail.load(std::memory_order_acquire);
+            Node *next = first->next.load(std::memory_order_acquire);
+            if (first != head.load(std::memory_order_acquire))
+                continue;
+
+            if (!next)
+                return false;
+
+            if (first == last)
+            {
+                tail.compare_exchange_weak(last, next);
+                continue;
+            }
+
+            if (head.compare_exchange_weak(first, next))
+            {
+                // next becomes the new dummy node and its item belongs to us,
+                // the guard keeps it alive even if it gets retired meanwhile;
+                // the item is gone from the queue even if consume throws
+                try
+                {
+                    consume(*(next->data));
+                }
+                catch (...)
+                {
+                    next->data->~Type();
+                    recycle(epoch.retire(first));
+                    throw;
+                }
+
+                next->data->~Type();
+                recycle(epoch.retire(first));
+                return true;
+            }
+        }
+    }
+
+    static void deleteChain(Node *ptr)
+    {
+        while (ptr)
+        {
+            Node *next = ptr->next.load(std::memory_order_relaxed);
+            delete ptr;
+            ptr = next;
+        }
+    }
+
+  public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using reference = Type &;
+    using const_reference = const Type &;
+
+    ConcurrentQueue() : pool(nullptr)
+    {
+        Node *dummy = new Node();
+        head.store(dummy);
+        tail.store(dummy);
+    }
+
+    ConcurrentQueue(const ConcurrentQueue &other) = delete;
+    ConcurrentQueue &operator=(const ConcurrentQueue &other) = delete;
+
+    ~ConcurrentQueue()
+    {
+        Node *ptr = head.load()->next.load();
+        while (ptr)
+        {
+            ptr->data->~Type();
+            ptr = ptr->next.load();
+        }
+
+        deleteChain(head.load());
+
+        EpochReclamation::Retired *chain = epoch.drain();
+        while (chain)
+        {
+            Node *ptr = static_cast<Node *>(chain);
+            chain = chain->retiredNext;
+            delete ptr;
+        }
+
+        deleteChain(pool.load());
+    }
+
+    // only a snapshot while other threads keep operating on the queue
+    bool isEmpty()
+    {
+        EpochReclamation::Guard guard(epoch);
+        return head.load()->next.load() == nullptr;
+    }
+
+    void append(const Type &item)
+    {
+        EpochReclamation::Guard guard(epoch);
+
+        Node *ptr = allocate();
+        try
+        {
+            ptr->data = new(ptr->buffer) Type(item);
+        }
+        catch (...)
+        {
+            // never published, so it goes straight back to the pool
+            pushToPool(ptr);
+            throw;
+        }
+
+        for (;;)
+        {
+            Node *last = tail.load(std::memory_order_acquire);
+            Node *next = last->next.load(std::memory_order_acquire);
+            if (last != tail.load(std::memory_order_acquire))
+                continue;
+
+            if (next)
+            {
+                tail.compare_exchange_weak(last, next);
+                continue;
+            }
+
+            if (last->next.compare_exchange_weak(next, ptr, std::memory_order_release,
+                                                 std::memory_order_relaxed))
+            {
+                tail.compare_exchange_strong(last, ptr);
+                return;
+            }
+        }
+    }
+
+    bool tryPopFirst(Type &item)
+    {
+        return consumeFirst([&item](Type &data) { item = std::move(data); });
+    }
+
+    Type popFirst()
+    {
+        alignas(Type) char buffer[sizeof(Type)];
+        Type *ptr = nullptr;
+        if (!consumeFirst([&buffer, &ptr](Type &data) { ptr = new(buffer) Type(std::move(data)); }))
+            throw std::logic_error("Collection already empty");
+
+        Type item(std::move(*ptr));
+        ptr->~Type();
+        return item;
+    }
+};
+
+template <typename Type>
+class ConcurrentQueue<Type>::Node : public EpochReclamation::Retired
+{
+  public:
+    alignas(Type) char buffer[sizeof(Type)];
+    Type *data;
+    std::atomic<Node *> next;
+
+    Node() : data(nullptr), next(nullptr) {}
+};
+}
+
+#endif // AISDI_LINEAR_CONCURRENTQUEUE_H
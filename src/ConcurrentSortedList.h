@@ -0,0 +1,221 @@
+#ifndef AISDI_LINEAR_CONCURRENTSORTEDLIST_H
+#define AISDI_LINEAR_CONCURRENTSORTEDLIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "EpochReclamation.h"
+
+namespace aisdi
+{
+
+// Lock-free sorted set of items (Harris, with Michael's single-unlinker
+// refinement). An item is removed by first marking the lowest bit of its
+// node's next pointer and then unlinking the node; nodes are freed through
+// epoch-based reclamation, so contains never waits for other threads.
+template <typename Type>
+class ConcurrentSortedList
+{
+  private:
+    class Node;
+
+    EpochReclamation epoch;
+    std::atomic<std::uintptr_t> head;
+    std::atomic<std::size_t> size;
+
+    static bool isMarked(std::uintptr_t link)
+    {
+        return link & 1;
+    }
+
+    static Node *nodeOf(std::uintptr_t link)
+    {
+        return reinterpret_cast<Node *>(link & ~static_cast<std::uintptr_t>(1));
+    }
+
+    static std::uintptr_t linkOf(Node *node, bool marked = false)
+    {
+        return reinterpret_cast<std::uintptr_t>(node) | (marked ? 1 : 0);
+    }
+
+    static bool equal(const Type &a, const Type &b)
+    {
+        return !(a < b) && !(b < a);
+    }
+
+    void release(EpochReclamation::Retired *chain)
+    {
+        while (chain)
+        {
+            Node *ptr = static_cast<Node *>(chain);
+            chain = chain->retiredNext;
+            delete ptr;
+        }
+    }
+
+    // Has to be called inside a guard. Positions prev and curr around the
+    // first node not less than item, unlinking marked nodes on the way.
+    bool find(const Type &item, std::atomic<std::uintptr_t> *&prev, Node *&curr)
+    {
+        for (;;)
+        {
+            bool restart = false;
+            prev = &head;
+            curr = nodeOf(prev->load(std::memory_order_acquire));
+            while (curr)
+            {
+                std::uintptr_t next = curr->next.load(std::memory_order_acquire);
+                if (isMarked(next))
+                {
+                    std::uintptr_t expected = linkOf(curr);
+                    if (!prev->compare_exchange_strong(expected, linkOf(nodeOf(next)),
+                                                       std::memory_order_acq_rel))
+                    {
+                        restart = true;
+                        break;
+                    }
+
+                    release(epoch.retire(curr));
+                    curr = nodeOf(next);
+                    continue;
+                }
+
+                if (!(*(curr->data) < item))
+                    return equal(*(curr->data), item);
+
+                prev = &curr->next;
+                curr = nodeOf(next);
+            }
+
+            if (!restart)
+                return false;
+        }
+    }
+
+  public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using reference = Type &;
+    using const_reference = const Type &;
+
+    ConcurrentSortedList() : head(0), size(0) {}
+
+    ConcurrentSortedList(const ConcurrentSortedList &other) = delete;
+    ConcurrentSortedList &operator=(const ConcurrentSortedList &other) = delete;
+
+    ~ConcurrentSortedList()
+    {
+        Node *ptr = nodeOf(head.load());
+        while (ptr)
+        {
+            Node *next = nodeOf(ptr->next.load());
+            delete ptr;
+            ptr = next;
+        }
+
+        release(epoch.drain());
+    }
+
+    // only a snapshot while other threads keep operating on the list
+    bool isEmpty() const
+    {
+        return size.load() == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size.load();
+    }
+
+    bool insert(const Type &item)
+    {
+        EpochReclamation::Guard guard(epoch);
+
+        Node *ptr = new Node(item);
+        std::atomic<std::uintptr_t> *prev;
+        Node *curr;
+        for (;;)
+        {
+            if (find(item, prev, curr))
+            {
+                delete ptr;
+                return false;
+            }
+
+            ptr->next.store(linkOf(curr), std::memory_order_relaxed);
+            std::uintptr_t expected = linkOf(curr);
+            if (prev->compare_exchange_strong(expected, linkOf(ptr), std::memory_order_release,
+                                              std::memory_order_relaxed))
+            {
+                size.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    bool erase(const Type &item)
+    {
+        EpochReclamation::Guard guard(epoch);
+
+        std::atomic<std::uintptr_t> *prev;
+        Node *curr;
+        for (;;)
+        {
+            if (!find(item, prev, curr))
+                return false;
+
+            std::uintptr_t next = curr->next.load(std::memory_order_acquire);
+            if (isMarked(next))
+                continue;
+
+            if (!curr->next.compare_exchange_strong(next, linkOf(nodeOf(next), true),
+                                                    std::memory_order_acq_rel))
+                continue;
+
+            size.fetch_sub(1, std::memory_order_relaxed);
+
+            std::uintptr_t expected = linkOf(curr);
+            if (prev->compare_exchange_strong(expected, next, std::memory_order_acq_rel))
+                release(epoch.retire(curr));
+            else
+                find(item, prev, curr);
+
+            return true;
+        }
+    }
+
+    bool contains(const Type &item)
+    {
+        EpochReclamation::Guard guard(epoch);
+
+        Node *curr = nodeOf(head.load(std::memory_order_acquire));
+        while (curr && *(curr->data) < item)
+            curr = nodeOf(curr->next.load(std::memory_order_acquire));
+
+        return curr && equal(*(curr->data), item) &&
+               !isMarked(curr->next.load(std::memory_order_acquire));
+    }
+};
+
+template <typename Type>
+class ConcurrentSortedList<Type>::Node : public EpochReclamation::Retired
+{
+  public:
+    alignas(Type) char buffer[sizeof(Type)];
+    Type *data;
+    std::atomic<std::uintptr_t> next;
+
+    Node(const Type &item) : next(0)
+    {
+        data = new(buffer) Type(item);
+    }
+
+    ~Node()
+    {
+        data->~Type();
+    }
+};
+}
+
+#endif // AISDI_LINEAR_CONCURRENTSORTEDLIST_H
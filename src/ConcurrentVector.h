@@ -0,0 +1,371 @@
+#ifndef AISDI_LINEAR_CONCURRENTVECTOR_H
+#define AISDI_LINEAR_CONCURRENTVECTOR_H
+
+#define INIT_SEGMENT_SIZE 64 // AN ITERATION OF 2!
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+
+namespace aisdi
+{
+
+// Append-only vector for many concurrent writers. Storage is a fixed table of
+// segments, segment k holding INIT_SEGMENT_SIZE << k items, so growing only
+// allocates the next segment and never moves items: their addresses stay
+// valid for the lifetime of the vector. getSize (and iteration) only covers
+// the published prefix, i.e. items whose every predecessor is constructed.
+// An append whose copy throws leaves a failed slot behind: it is counted by
+// getSize, skipped by iteration, and operator[] throws for it.
+template <typename Type>
+class ConcurrentVector
+{
+  private:
+    // EMPTY is 0, so value-initialized states start out empty
+    enum ItemState : unsigned char
+    {
+        EMPTY,
+        CONSTRUCTED,
+        FAILED
+    };
+
+    // The states are kept in their own array, next to the items rather than
+    // in front of each, where a state byte would pad a small item out to
+    // twice its size.
+    struct Segment
+    {
+        char *buffer;
+        std::atomic<unsigned char> *states;
+
+        explicit Segment(std::size_t capacity) : buffer(new char[sizeof(Type) * capacity]), states(nullptr)
+        {
+            try
+            {
+                states = new std::atomic<unsigned char>[capacity]();
+            }
+            catch (...)
+            {
+                delete [] buffer;
+                throw;
+            }
+        }
+
+        ~Segment()
+        {
+            delete [] states;
+            delete [] buffer;
+        }
+
+        Type *data(std::size_t offset)
+        {
+            return reinterpret_cast<Type *>(buffer) + offset;
+        }
+    };
+
+    static const std::size_t segmentCount =
+        sizeof(std::size_t) * 8 - std::countr_zero(std::size_t(INIT_SEGMENT_SIZE)) + 1;
+
+    std::atomic<Segment *> segments[segmentCount];
+    std::atomic<std::size_t> reserved;
+    std::atomic<std::size_t> published;
+
+    static std::size_t segmentOf(std::size_t index)
+    {
+        return std::bit_width(index / INIT_SEGMENT_SIZE + 1) - 1;
+    }
+
+    static std::size_t segmentBegin(std::size_t segment)
+    {
+        return INIT_SEGMENT_SIZE * ((std::size_t(1) << segment) - 1);
+    }
+
+    Type *itemAt(std::size_t index) const
+    {
+        std::size_t segment = segmentOf(index);
+        return segments[segment].load(std::memory_order_acquire)->data(index - segmentBegin(segment));
+    }
+
+    std::atomic<unsigned char> &stateAt(std::size_t index) const
+    {
+        std::size_t segment = segmentOf(index);
+        return segments[segment].load(std::memory_order_acquire)->states[index - segmentBegin(segment)];
+    }
+
+    // marks a segment slot while its first writer allocates it
+    static Segment *allocating()
+    {
+        return reinterpret_cast<Segment *>(std::uintptr_t(1));
+    }
+
+    // The first writer reaching a segment claims its slot and allocates it,
+    // the others wait instead of each allocating a copy of a segment that
+    // may hold millions of items. If the allocation throws the slot is
+    // released, so that a waiting writer retries it.
+    Segment *acquireSegment(std::size_t segment)
+    {
+        Segment *ptr = segments[segment].load(std::memory_order_acquire);
+        while (!ptr || ptr == allocating())
+        {
+            if (!ptr && segments[segment].compare_exchange_weak(ptr, allocating(), std::memory_order_acquire))
+            {
+                try
+                {
+                    ptr = new Segment(std::size_t(INIT_SEGMENT_SIZE) << segment);
+                }
+                catch (...)
+                {
+                    segments[segment].store(nullptr, std::memory_order_release);
+                    throw;
+                }
+
+                segments[segment].store(ptr, std::memory_order_release);
+                return ptr;
+            }
+
+            if (ptr == allocating())
+            {
+                std::this_thread::yield();
+                ptr = segments[segment].load(std::memory_order_acquire);
+            }
+        }
+
+        return ptr;
+    }
+
+    // Moves the published size past every consecutive constructed (or failed)
+    // item.
+    // Whichever writer finishes the oldest pending item carries it further.
+    // The reservation, the state stores and these loads are all seq_cst: a
+    // writer that stops here on an empty state is thus seen by the writer
+    // filling that state, which carries publication on past it.
+    void publish()
+    {
+        std::size_t size = published.load();
+        while (size < reserved.load())
+        {
+            std::size_t segment = segmentOf(size);
+            Segment *ptr = segments[segment].load(std::memory_order_acquire);
+            if (!ptr || ptr == allocating() || ptr->states[size - segmentBegin(segment)].load() == EMPTY)
+                return;
+
+            if (published.compare_exchange_weak(size, size + 1))
+                ++size;
+        }
+    }
+
+    bool isFailed(std::size_t index) const
+    {
+        return stateAt(index).load(std::memory_order_relaxed) == FAILED;
+    }
+
+    // first index from index on that holds an item, or size
+    std::size_t skipFailed(std::size_t index, std::size_t size) const
+    {
+        while (index < size && isFailed(index))
+            ++index;
+        return index;
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type *;
+    using reference = Type &;
+    using const_pointer = const Type *;
+    using const_reference = const Type &;
+
+    class ConstIterator;
+    using const_iterator = ConstIterator;
+
+    ConcurrentVector() : reserved(0), published(0)
+    {
+        for (std::size_t i = 0; i < segmentCount; ++i)
+            segments[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    ConcurrentVector(const ConcurrentVector &other) = delete;
+    ConcurrentVector &operator=(const ConcurrentVector &other) = delete;
+
+    ~ConcurrentVector()
+    {
+        for (std::size_t i = 0; i < segmentCount; ++i)
+        {
+            Segment *segment = segments[i].load();
+            if (!segment)
+                continue;
+
+            for (std::size_t j = 0; j < (std::size_t(INIT_SEGMENT_SIZE) << i); ++j)
+                if (segment->states[j].load() == CONSTRUCTED)
+                    segment->data(j)->~Type();
+            delete segment;
+        }
+    }
+
+    // only a snapshot while other threads keep appending
+    bool isEmpty() const
+    {
+        return published.load() == 0;
+    }
+
+    size_type getSize() const
+    {
+        return published.load();
+    }
+
+    // Returns the index of the appended item, which may be read through
+    // operator[] once getSize() exceeds it. If the copy throws, the slot is
+    // marked failed so that publication still moves past it. A failed
+    // segment allocation is not recovered from: publication stops there.
+    size_type append(const Type &item)
+    {
+        std::size_t index = reserved.fetch_add(1);
+        std::size_t segment = segmentOf(index);
+        Segment *ptr = acquireSegment(segment);
+        std::size_t offset = index - segmentBegin(segment);
+
+        try
+        {
+            new(ptr->data(offset)) Type(item);
+        }
+        catch (...)
+        {
+            ptr->states[offset].store(FAILED);
+            publish();
+            throw;
+        }
+
+        ptr->states[offset].store(CONSTRUCTED);
+        publish();
+        return index;
+    }
+
+    reference operator[](size_type index)
+    {
+        if (index >= published.load(std::memory_order_acquire))
+            throw std::out_of_range("Index out of range");
+        if (isFailed(index))
+            throw std::out_of_range("Item was not constructed");
+
+        return *itemAt(index);
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        if (index >= published.load(std::memory_order_acquire))
+            throw std::out_of_range("Index out of range");
+        if (isFailed(index))
+            throw std::out_of_range("Item was not constructed");
+
+        return *itemAt(index);
+    }
+
+    // The range is fixed when begin() is called, items published later are
+    // not visited.
+    const_iterator cbegin() const
+    {
+        std::size_t size = published.load(std::memory_order_acquire);
+        return const_iterator(this, skipFailed(0, size), size);
+    }
+
+    const_iterator cend() const
+    {
+        std::size_t size = published.load(std::memory_order_acquire);
+        return const_iterator(this, size, size);
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+
+template <typename Type>
+class ConcurrentVector<Type>::ConstIterator
+{
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename ConcurrentVector::value_type;
+    using difference_type = typename ConcurrentVector::difference_type;
+    using pointer = typename ConcurrentVector::const_pointer;
+    using reference = typename ConcurrentVector::const_reference;
+
+  private:
+    const ConcurrentVector *vector;
+    std::size_t index;
+    std::size_t size;
+
+  public:
+    explicit ConstIterator(const ConcurrentVector *vector, std::size_t index, std::size_t size)
+        : vector(vector), index(index), size(size)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (index >= size)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        return *vector->itemAt(index);
+    }
+
+    ConstIterator &operator++()
+    {
+        if (index >= size)
+            throw std::out_of_range("The next iterator does not exist");
+
+        index = vector->skipFailed(index + 1, size);
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(*this);
+        ++(*this);
+        return tmp;
+    }
+
+    ConstIterator &operator--()
+    {
+        std::size_t position = index;
+        do
+        {
+            if (position == 0)
+                throw std::out_of_range("The previous iterator does not exist");
+            --position;
+        }
+        while (vector->isFailed(position));
+
+        index = position;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator tmp(*this);
+        --(*this);
+        return tmp;
+    }
+
+    pointer operator->() const
+    {
+        return &this->operator*();
+    }
+
+    // iterators taken at different times compare by position only
+    bool operator==(const ConstIterator &other) const
+    {
+        return vector == other.vector && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+}
+
+#endif // AISDI_LINEAR_CONCURRENTVECTOR_H
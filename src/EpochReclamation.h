@@ -0,0 +1,159 @@
+#ifndef AISDI_LINEAR_EPOCHRECLAMATION_H
+#define AISDI_LINEAR_EPOCHRECLAMATION_H
+
+#define EPOCH_SLOTS 64 // MAXIMUM NUMBER OF THREADS INSIDE GUARDS AT ONCE
+#define EPOCH_RECLAIM_INTERVAL 64 // RETIREMENTS BETWEEN ATTEMPTS TO ADVANCE THE EPOCH
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace aisdi
+{
+
+// Epoch-based reclamation for lock-free collections. Every access to shared
+// nodes happens inside a Guard; a retired node is handed back to its owner
+// only after the global epoch advanced twice, i.e. when no thread that could
+// still hold a pointer to it remains inside a guard.
+class EpochReclamation
+{
+  public:
+    struct Retired
+    {
+        Retired *retiredNext;
+
+        Retired() : retiredNext(nullptr) {}
+    };
+
+    class Guard;
+
+  private:
+    struct alignas(64) Slot
+    {
+        // zero when free, (epoch << 1) | 1 when owned by a thread inside a guard
+        std::atomic<std::uint64_t> state;
+
+        Slot() : state(0) {}
+    };
+
+    std::atomic<std::uint64_t> globalEpoch;
+    std::atomic<std::size_t> retireCount;
+    std::atomic<Retired *> limbo[3];
+    Slot slots[EPOCH_SLOTS];
+
+    Slot *enter()
+    {
+        std::size_t index = std::hash<std::thread::id>()(std::this_thread::get_id()) % EPOCH_SLOTS;
+        std::uint64_t epoch = globalEpoch.load();
+
+        for (;;)
+        {
+            std::uint64_t expected = 0;
+            if (slots[index].state.compare_exchange_weak(expected, (epoch << 1) | 1))
+                break;
+
+            index = (index + 1) % EPOCH_SLOTS;
+            if (index == 0)
+                std::this_thread::yield();
+        }
+
+        Slot *slot = &slots[index];
+        while (globalEpoch.load() != epoch)
+        {
+            epoch = globalEpoch.load();
+            slot->state.store((epoch << 1) | 1);
+        }
+
+        return slot;
+    }
+
+    static void leave(Slot *slot)
+    {
+        slot->state.store(0, std::memory_order_release);
+    }
+
+    Retired *tryAdvance()
+    {
+        std::uint64_t epoch = globalEpoch.load();
+        for (const Slot &slot : slots)
+        {
+            std::uint64_t state = slot.state.load();
+            if ((state & 1) && (state >> 1) != epoch)
+                return nullptr;
+        }
+
+        if (!globalEpoch.compare_exchange_strong(epoch, epoch + 1))
+            return nullptr;
+
+        // nodes retired two epochs ago are unreachable for every active guard
+        return limbo[(epoch + 2) % 3].exchange(nullptr, std::memory_order_acquire);
+    }
+
+  public:
+    EpochReclamation() : globalEpoch(0), retireCount(0)
+    {
+        for (auto &list : limbo)
+            list.store(nullptr);
+    }
+
+    EpochReclamation(const EpochReclamation &other) = delete;
+    EpochReclamation &operator=(const EpochReclamation &other) = delete;
+
+    // Has to be called inside a guard. Returns a chain of nodes (linked by
+    // retiredNext) that became safe to reuse, or nullptr.
+    Retired *retire(Retired *node)
+    {
+        std::atomic<Retired *> &list = limbo[globalEpoch.load() % 3];
+        node->retiredNext = list.load(std::memory_order_relaxed);
+        while (!list.compare_exchange_weak(node->retiredNext, node, std::memory_order_release,
+                                           std::memory_order_relaxed))
+        {
+        }
+
+        if (retireCount.fetch_add(1, std::memory_order_relaxed) % EPOCH_RECLAIM_INTERVAL != 0)
+            return nullptr;
+
+        return tryAdvance();
+    }
+
+    // Hands back every retired node; only valid once no thread is inside a guard.
+    Retired *drain()
+    {
+        Retired *chain = nullptr;
+        for (auto &list : limbo)
+        {
+            Retired *ptr = list.exchange(nullptr);
+            while (ptr)
+            {
+                Retired *next = ptr->retiredNext;
+                ptr->retiredNext = chain;
+                chain = ptr;
+                ptr = next;
+            }
+        }
+
+        return chain;
+    }
+};
+
+class EpochReclamation::Guard
+{
+  private:
+    EpochReclamation::Slot *slot;
+
+  public:
+    explicit Guard(EpochReclamation &domain) : slot(domain.enter()) {}
+
+    Guard(const Guard &other) = delete;
+    Guard &operator=(const Guard &other) = delete;
+
+    ~Guard()
+    {
+        EpochReclamation::leave(slot);
+    }
+};
+}
+
+#endif // AISDI_LINEAR_EPOCHRECLAMATION_H
@@ -0,0 +1,175 @@
+#ifndef AISDI_LINEAR_FLATCOMBINED_H
+#define AISDI_LINEAR_FLATCOMBINED_H
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace aisdi
+{
+
+// Flat-combining adapter for the sequential collections (LinkedList, Vector).
+// Every call publishes an operation record; whichever thread holds the
+// combiner lock applies all published records in one batch, so the
+// collection stays hot in a single cache instead of bouncing between cores.
+template <typename Container>
+class FlatCombined
+{
+  private:
+    struct Record
+    {
+        Record *next;
+        void (*invoke)(void *operation, Container &container);
+        void *operation;
+        std::exception_ptr error;
+        std::atomic<bool> done;
+
+        Record() : next(nullptr), invoke(nullptr), operation(nullptr), done(false) {}
+    };
+
+    Container container;
+    std::mutex combinerLock;
+    std::atomic<Record *> published;
+
+    template <typename Operation>
+    static void invokeOperation(void *operation, Container &container)
+    {
+        (*static_cast<Operation *>(operation))(container);
+    }
+
+    void combine()
+    {
+        Record *batch = published.exchange(nullptr, std::memory_order_acquire);
+
+        // records were pushed onto a stack, restore the arrival order
+        Record *ordered = nullptr;
+        while (batch)
+        {
+            Record *next = batch->next;
+            batch->next = ordered;
+            ordered = batch;
+            batch = next;
+        }
+
+        while (ordered)
+        {
+            Record *next = ordered->next;
+            try
+            {
+                ordered->invoke(ordered->operation, container);
+            }
+            catch (...)
+            {
+                ordered->error = std::current_exception();
+            }
+
+            // the publishing thread may return as soon as it sees done
+            ordered->done.store(true, std::memory_order_release);
+            ordered = next;
+        }
+    }
+
+  public:
+    using size_type = typename Container::size_type;
+    using value_type = typename Container::value_type;
+
+    FlatCombined() : published(nullptr) {}
+
+    FlatCombined(const FlatCombined &other) = delete;
+    FlatCombined &operator=(const FlatCombined &other) = delete;
+
+    // Runs operation(container) under the combiner lock, possibly on another
+    // thread. Exceptions thrown by the operation are rethrown to the caller.
+    template <typename Operation>
+    void apply(Operation operation)
+    {
+        Record record;
+        record.invoke = &FlatCombined::invokeOperation<Operation>;
+        record.operation = &operation;
+
+        record.next = published.load(std::memory_order_relaxed);
+        while (!published.compare_exchange_weak(record.next, &record, std::memory_order_release,
+                                                std::memory_order_relaxed))
+        {
+        }
+
+        while (!record.done.load(std::memory_order_acquire))
+        {
+            if (combinerLock.try_lock())
+            {
+                combine();
+                combinerLock.unlock();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        if (record.error)
+            std::rethrow_exception(record.error);
+    }
+
+    bool isEmpty()
+    {
+        bool result = false;
+        apply([&result](Container &c) { result = c.isEmpty(); });
+        return result;
+    }
+
+    size_type getSize()
+    {
+        size_type result = 0;
+        apply([&result](Container &c) { result = c.getSize(); });
+        return result;
+    }
+
+    void append(const value_type &item)
+    {
+        apply([&item](Container &c) { c.append(item); });
+    }
+
+    void prepend(const value_type &item)
+    {
+        apply([&item](Container &c) { c.prepend(item); });
+    }
+
+    // position is an index, iterators cannot outlive a single operation
+    void insert(size_type position, const value_type &item)
+    {
+        apply([position, &item](Container &c) { c.insert(c.cbegin() + position, item); });
+    }
+
+    void erase(size_type position)
+    {
+        apply([position](Container &c) { c.erase(c.cbegin() + position); });
+    }
+
+    value_type popFirst()
+    {
+        alignas(value_type) char buffer[sizeof(value_type)];
+        value_type *ptr = nullptr;
+        apply([&buffer, &ptr](Container &c) { ptr = new(buffer) value_type(c.popFirst()); });
+
+        value_type item(std::move(*ptr));
+        ptr->~value_type();
+        return item;
+    }
+
+    value_type popLast()
+    {
+        alignas(value_type) char buffer[sizeof(value_type)];
+        value_type *ptr = nullptr;
+        apply([&buffer, &ptr](Container &c) { ptr = new(buffer) value_type(c.popLast()); });
+
+        value_type item(std::move(*ptr));
+        ptr->~value_type();
+        return item;
+    }
+};
+}
+
+#endif // AISDI_LINEAR_FLATCOMBINED_H
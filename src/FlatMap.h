@@ -0,0 +1,159 @@
+#ifndef AISDI_LINEAR_FLATMAP_H
+#define AISDI_LINEAR_FLATMAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "FlatSet.h"
+#include "Vector.h"
+
+namespace aisdi
+{
+
+// Map kept as key-value pairs sorted by key in one contiguous array, the
+// FlatSet counterpart of a node-based map. The items are iterated read-only,
+// values are changed through at() and operator[].
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class FlatMap
+{
+  public:
+    using value_type = std::pair<Key, Value>;
+
+  private:
+    struct KeyOfItem
+    {
+        const Key &operator()(const value_type &item) const
+        {
+            return item.first;
+        }
+    };
+
+    FlatStorage<value_type, KeyOfItem, Compare> storage;
+
+  public:
+    using size_type = std::size_t;
+    using key_type = Key;
+    using mapped_type = Value;
+    using const_reference = const value_type &;
+    using const_iterator = typename Vector<value_type>::ConstIterator;
+    using iterator = const_iterator;
+
+    explicit FlatMap(const Compare &compare = Compare()) : storage(compare) {}
+
+    FlatMap(std::initializer_list<value_type> l, const Compare &compare = Compare()) : storage(compare)
+    {
+        insertBatch(l.begin(), l.end());
+    }
+
+    bool isEmpty() const
+    {
+        return storage.items.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return storage.items.getSize();
+    }
+
+    // false, and the value is left as it was, when the key was already there
+    bool insert(const Key &key, const Value &value)
+    {
+        return storage.insert(value_type(key, value)).second;
+    }
+
+    void insertOrAssign(const Key &key, const Value &value)
+    {
+        std::pair<std::size_t, bool> result = storage.insert(value_type(key, value));
+        if (!result.second)
+            storage.items[result.first].second = value;
+    }
+
+    // Returns the number of keys that were not there yet; values of keys
+    // already present are left as they were.
+    template <typename InputIterator>
+    size_type insertBatch(InputIterator first, InputIterator last)
+    {
+        return storage.insertBatch(first, last);
+    }
+
+    bool erase(const Key &key)
+    {
+        return storage.erase(key);
+    }
+
+    bool contains(const Key &key) const
+    {
+        return storage.find(key) != getSize();
+    }
+
+    Value &at(const Key &key)
+    {
+        std::size_t position = storage.find(key);
+        if (position == getSize())
+            throw std::out_of_range("Key not found");
+
+        return storage.items[position].second;
+    }
+
+    const Value &at(const Key &key) const
+    {
+        std::size_t position = storage.find(key);
+        if (position == getSize())
+            throw std::out_of_range("Key not found");
+
+        return storage.items[position].second;
+    }
+
+    // inserts a default-constructed value for a missing key
+    Value &operator[](const Key &key)
+    {
+        std::size_t position = storage.lowerBound(key);
+        if (position == getSize() || storage.less(key, storage.items[position].first))
+            storage.items.insert(storage.at(position), value_type(key, Value()));
+
+        return storage.items[position].second;
+    }
+
+    const_iterator find(const Key &key) const
+    {
+        return storage.at(storage.find(key));
+    }
+
+    const_iterator lowerBound(const Key &key) const
+    {
+        return storage.at(storage.lowerBound(key));
+    }
+
+    const_iterator upperBound(const Key &key) const
+    {
+        return storage.at(storage.upperBound(key));
+    }
+
+    // items with keys in [from, to)
+    std::pair<const_iterator, const_iterator> range(const Key &from, const Key &to) const
+    {
+        std::size_t first = storage.lowerBound(from);
+        return { storage.at(first), storage.at(std::max(first, storage.lowerBound(to))) };
+    }
+
+    const_iterator cbegin() const
+    {
+        return storage.items.cbegin();
+    }
+
+    const_iterator cend() const
+    {
+        return storage.items.cend();
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+}
+
+#endif // AISDI_LINEAR_FLATMAP_H
@@ -0,0 +1,256 @@
+#ifndef AISDI_LINEAR_FLATSET_H
+#define AISDI_LINEAR_FLATSET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#include "Vector.h"
+
+namespace aisdi
+{
+
+// Items kept sorted by key in an aisdi::Vector, shared by FlatSet and
+// FlatMap. Lookups are binary searches over contiguous memory; single
+// inserts shift the tail, batches are sorted and merged in one pass.
+template <typename Item, typename KeyOf, typename Compare>
+class FlatStorage
+{
+  public:
+    using Key = std::remove_cv_t<std::remove_reference_t<decltype(KeyOf()(std::declval<const Item &>()))>>;
+    using const_iterator = typename Vector<Item>::ConstIterator;
+
+    Vector<Item> items;
+    Compare less;
+
+    explicit FlatStorage(const Compare &less) : items(), less(less) {}
+
+    bool before(const Item &first, const Item &second) const
+    {
+        return less(KeyOf()(first), KeyOf()(second));
+    }
+
+    // index of the first item not ordered before key
+    std::size_t lowerBound(const Key &key) const
+    {
+        std::size_t first = 0;
+        std::size_t count = items.getSize();
+        while (count > 0)
+        {
+            std::size_t half = count / 2;
+            if (less(KeyOf()(items[first + half]), key))
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+                count = half;
+        }
+        return first;
+    }
+
+    // index of the first item ordered after key
+    std::size_t upperBound(const Key &key) const
+    {
+        std::size_t first = 0;
+        std::size_t count = items.getSize();
+        while (count > 0)
+        {
+            std::size_t half = count / 2;
+            if (!less(key, KeyOf()(items[first + half])))
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+                count = half;
+        }
+        return first;
+    }
+
+    // index of the item with key, or the size when there is none
+    std::size_t find(const Key &key) const
+    {
+        std::size_t position = lowerBound(key);
+        if (position < items.getSize() && !less(key, KeyOf()(items[position])))
+            return position;
+        return items.getSize();
+    }
+
+    const_iterator at(std::size_t position) const
+    {
+        return items.cbegin() + position;
+    }
+
+    // index of the item with the key of item, and whether it was inserted
+    std::pair<std::size_t, bool> insert(const Item &item)
+    {
+        std::size_t position = lowerBound(KeyOf()(item));
+        if (position < items.getSize() && !before(item, items[position]))
+            return { position, false };
+
+        items.insert(at(position), item);
+        return { position, true };
+    }
+
+    bool erase(const Key &key)
+    {
+        std::size_t position = find(key);
+        if (position == items.getSize())
+            return false;
+
+        items.erase(at(position));
+        return true;
+    }
+
+    // Sorts the batch and merges it with the items in one linear pass.
+    // Items already present win over the batch, and so do earlier batch
+    // items over later ones with the same key.
+    template <typename InputIterator>
+    std::size_t insertBatch(InputIterator first, InputIterator last)
+    {
+        Vector<Item> batch;
+        for (; first != last; ++first)
+            batch.append(*first);
+        if (batch.isEmpty())
+            return 0;
+
+        std::size_t batchSize = batch.getSize();
+        Item *added = &batch[0];
+        std::stable_sort(added, added + batchSize,
+                         [this](const Item &a, const Item &b) { return before(a, b); });
+
+        std::size_t size = items.getSize();
+        Item *present = size > 0 ? &items[0] : nullptr;
+        Vector<Item> merged(size + batchSize);
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < size || j < batchSize)
+        {
+            if (j == batchSize || (i < size && !before(added[j], present[i])))
+            {
+                // batch items with the key of this one are dropped
+                while (j < batchSize && !before(present[i], added[j]))
+                    ++j;
+                merged.append(std::move(present[i++]));
+            }
+            else
+            {
+                merged.append(std::move(added[j++]));
+                while (j < batchSize && !before(merged[merged.getSize() - 1], added[j]))
+                    ++j;
+            }
+        }
+
+        std::size_t inserted = merged.getSize() - size;
+        items = std::move(merged);
+        return inserted;
+    }
+};
+
+// Sorted set of unique keys in one contiguous array. Best for read-mostly
+// data: lookups are binary searches, inserting a batch with insertBatch
+// costs a single merge.
+template <typename Key, typename Compare = std::less<Key>>
+class FlatSet
+{
+  private:
+    struct Identity
+    {
+        const Key &operator()(const Key &key) const
+        {
+            return key;
+        }
+    };
+
+    FlatStorage<Key, Identity, Compare> storage;
+
+  public:
+    using size_type = std::size_t;
+    using value_type = Key;
+    using const_reference = const Key &;
+    using const_iterator = typename Vector<Key>::ConstIterator;
+    using iterator = const_iterator;
+
+    explicit FlatSet(const Compare &compare = Compare()) : storage(compare) {}
+
+    FlatSet(std::initializer_list<Key> l, const Compare &compare = Compare()) : storage(compare)
+    {
+        insertBatch(l.begin(), l.end());
+    }
+
+    bool isEmpty() const
+    {
+        return storage.items.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return storage.items.getSize();
+    }
+
+    // false when the key was already there
+    bool insert(const Key &key)
+    {
+        return storage.insert(key).second;
+    }
+
+    // returns the number of keys that were not there yet
+    template <typename InputIterator>
+    size_type insertBatch(InputIterator first, InputIterator last)
+    {
+        return storage.insertBatch(first, last);
+    }
+
+    bool erase(const Key &key)
+    {
+        return storage.erase(key);
+    }
+
+    bool contains(const Key &key) const
+    {
+        return storage.find(key) != getSize();
+    }
+
+    const_iterator find(const Key &key) const
+    {
+        return storage.at(storage.find(key));
+    }
+
+    const_iterator lowerBound(const Key &key) const
+    {
+        return storage.at(storage.lowerBound(key));
+    }
+
+    const_iterator upperBound(const Key &key) const
+    {
+        return storage.at(storage.upperBound(key));
+    }
+
+    // keys in [from, to)
+    std::pair<const_iterator, const_iterator> range(const Key &from, const Key &to) const
+    {
+        std::size_t first = storage.lowerBound(from);
+        return { storage.at(first), storage.at(std::max(first, storage.lowerBound(to))) };
+    }
+
+    const_iterator cbegin() const
+    {
+        return storage.items.cbegin();
+    }
+
+    const_iterator cend() const
+    {
+        return storage.items.cend();
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+}
+
+#endif // AISDI_LINEAR_FLATSET_H
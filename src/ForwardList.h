@@ -0,0 +1,323 @@
+#ifndef AISDI_LINEAR_FORWARDLIST_H
+#define AISDI_LINEAR_FORWARDLIST_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+template <typename Type>
+class ForwardList
+{
+  private:
+    class Node;
+    Node *sentinel;
+    Node *last;
+    std::size_t size;
+
+    void clear()
+    {
+        Node *ptr = sentinel->next;
+        Node *next;
+        while(ptr != sentinel)
+        {
+            next = ptr->next;
+            delete ptr;
+            ptr = next;
+        }
+
+        sentinel->next = sentinel;
+        last = sentinel;
+        size = 0;
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type *;
+    using reference = Type &;
+    using const_pointer = const Type *;
+    using const_reference = const Type &;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    ForwardList()
+    {
+        sentinel = new Node();
+        last = sentinel;
+        size = 0;
+    }
+
+    ForwardList(std::initializer_list<Type> l) : ForwardList()
+    {
+        for (const Type &i : l)
+            append(i);
+    }
+
+    ForwardList(const ForwardList &other) : ForwardList()
+    {
+        for (auto i = other.begin(); i != other.end(); i++)
+            append(*i);
+    }
+
+    ForwardList(ForwardList &&other) : sentinel(nullptr), last(nullptr), size(0)
+    {
+        *this = std::move(other);
+    }
+
+    ~ForwardList()
+    {
+        if (sentinel)
+        {
+            clear();
+            delete sentinel;
+        }
+    }
+
+    ForwardList &operator=(const ForwardList &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (auto i = other.begin(); i != other.end(); i++)
+                append(*i);
+        }
+
+        return *this;
+    }
+
+    ForwardList &operator=(ForwardList &&other)
+    {
+        if (this != &other)
+        {
+            if (sentinel)
+            {
+                clear();
+                delete sentinel;
+            }
+
+            sentinel = other.sentinel;
+            last = other.last;
+            size = other.size;
+
+            other.sentinel = nullptr;
+            other.last = nullptr;
+            other.size = 0;
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return sentinel->next == sentinel;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    void append(const Type &item)
+    {
+        Node *ptr = new Node(item);
+        ptr->next = sentinel;
+        last->next = ptr;
+        last = ptr;
+        size++;
+    }
+
+    void prepend(const Type &item)
+    {
+        Node *ptr = new Node(item);
+        ptr->next = sentinel->next;
+        sentinel->next = ptr;
+        if (last == sentinel)
+            last = ptr;
+        size++;
+    }
+
+    Type popFirst()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        Node *ptr = sentinel->next;
+        sentinel->next = ptr->next;
+        if (ptr == last)
+            last = sentinel;
+
+        Type data = *(ptr->data);
+        delete ptr;
+        size--;
+        return data;
+    }
+
+    iterator begin()
+    {
+        return iterator(sentinel->next, sentinel);
+    }
+
+    iterator end()
+    {
+        return iterator(sentinel, sentinel);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(sentinel->next, sentinel);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(sentinel, sentinel);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type>
+class ForwardList<Type>::Node
+{
+  private:
+    bool isSentinel;
+
+  public:
+    char buffer[sizeof(Type)];
+    Type *data;
+    Node *next;
+
+    Node() : isSentinel(true), next(this) {}
+
+    Node(const Type &item) : Node()
+    {
+        data = new(buffer) Type(item);
+        isSentinel = false;
+    }
+
+    ~Node()
+    {
+        if (!isSentinel)
+            data->~Type();
+    }
+};
+
+template <typename Type>
+class ForwardList<Type>::ConstIterator
+{
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename ForwardList::value_type;
+    using difference_type = typename ForwardList::difference_type;
+    using pointer = typename ForwardList::const_pointer;
+    using reference = typename ForwardList::const_reference;
+
+    ForwardList<Type>::Node *ptr;
+    ForwardList<Type>::Node *sentinel;
+
+    explicit ConstIterator(ForwardList<Type>::Node *ptr, ForwardList<Type>::Node *sentinel) : ptr(ptr), sentinel(sentinel)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (ptr == sentinel)
+            throw std::out_of_range("This iterator does not point to a valid node");
+
+        return *(ptr->data);
+    }
+
+    ConstIterator &operator++()
+    {
+        if (ptr == sentinel)
+            throw std::out_of_range("The next iterator does not exist");
+
+        ptr = ptr->next;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(ptr, sentinel);
+        ++(*this);
+        return tmp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        ConstIterator tmp(ptr, sentinel);
+        for (auto i = 0; i < d; i++)
+            ++tmp;
+        return tmp;
+    }
+
+    bool operator==(const ConstIterator &other) const
+    {
+        return this->ptr == other.ptr;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type>
+class ForwardList<Type>::Iterator : public ForwardList<Type>::ConstIterator
+{
+  public:
+    using pointer = typename ForwardList::pointer;
+    using reference = typename ForwardList::reference;
+
+    explicit Iterator(ForwardList<Type>::Node *ptr, ForwardList<Type>::Node *sentinel) : ConstIterator(ptr, sentinel)
+    {
+    }
+
+    Iterator(const ConstIterator &other)
+        : ConstIterator(other)
+    {
+    }
+
+    Iterator &operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+}
+
+#endif // AISDI_LINEAR_FORWARDLIST_H
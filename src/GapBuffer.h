@@ -0,0 +1,436 @@
+#ifndef AISDI_LINEAR_GAPBUFFER_H
+#define AISDI_LINEAR_GAPBUFFER_H
+
+#define INIT_GAP_BUFFER_SIZE 64 // AN ITERATION OF 2!
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+// Vector with a gap of free slots kept at the last edit position. Inserting
+// or erasing at the gap is O(1), moving the gap to another position costs
+// O(distance), so bursts of edits around one cursor never shift the tail.
+template <typename Type>
+class GapBuffer
+{
+  private:
+    std::size_t bufCapacity;
+    std::size_t gapBegin;
+    std::size_t gapEnd;
+    char *storage;
+    Type *items;
+
+    std::size_t gapSize() const
+    {
+        return gapEnd - gapBegin;
+    }
+
+    Type *itemAt(std::size_t index) const
+    {
+        return items + (index < gapBegin ? index : index + gapSize());
+    }
+
+    static void relocate(Type *from, Type *to)
+    {
+        new(to) Type(std::move(*from));
+        from->~Type();
+    }
+
+    void moveGap(std::size_t position)
+    {
+        if (gapBegin == gapEnd)
+        {
+            // an empty gap can be anywhere, nothing to relocate
+            gapBegin = gapEnd = position;
+            return;
+        }
+
+        while (position < gapBegin)
+        {
+            --gapBegin;
+            --gapEnd;
+            relocate(items + gapBegin, items + gapEnd);
+        }
+
+        while (position > gapBegin)
+        {
+            relocate(items + gapEnd, items + gapBegin);
+            ++gapBegin;
+            ++gapEnd;
+        }
+    }
+
+    void increaseSize()
+    {
+        std::size_t newCapacity = bufCapacity ? bufCapacity << 1 : INIT_GAP_BUFFER_SIZE;
+        char *newStorage = new char[sizeof(Type) * newCapacity];
+        Type *newItems = reinterpret_cast<Type *>(newStorage);
+
+        std::size_t tail = bufCapacity - gapEnd;
+        for (std::size_t i = 0; i < gapBegin; ++i)
+            relocate(items + i, newItems + i);
+        for (std::size_t i = 0; i < tail; ++i)
+            relocate(items + gapEnd + i, newItems + newCapacity - tail + i);
+
+        delete [] storage;
+        storage = newStorage;
+        items = newItems;
+        gapEnd = newCapacity - tail;
+        bufCapacity = newCapacity;
+    }
+
+    void insertAt(std::size_t index, const Type &item)
+    {
+        if (gapBegin == gapEnd)
+            increaseSize();
+
+        moveGap(index);
+        new(items + gapBegin) Type(item);
+        ++gapBegin;
+    }
+
+    // erases count items starting at index
+    void eraseAt(std::size_t index, std::size_t count)
+    {
+        moveGap(index);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            items[gapEnd].~Type();
+            ++gapEnd;
+        }
+    }
+
+    // destroys the items where they are, the whole buffer becomes the gap
+    void clear()
+    {
+        for (std::size_t i = 0; i < gapBegin; ++i)
+            items[i].~Type();
+        for (std::size_t i = gapEnd; i < bufCapacity; ++i)
+            items[i].~Type();
+
+        gapBegin = 0;
+        gapEnd = bufCapacity;
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type *;
+    using reference = Type &;
+    using const_pointer = const Type *;
+    using const_reference = const Type &;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    GapBuffer() : bufCapacity(0), gapBegin(0), gapEnd(0), storage(nullptr), items(nullptr) {}
+
+    GapBuffer(std::initializer_list<Type> l) : GapBuffer()
+    {
+        for (const Type& el : l)
+            append(el);
+    }
+
+    GapBuffer(const GapBuffer &other) : GapBuffer()
+    {
+        for (auto i = other.begin(); i != other.end(); i++)
+            append(*i);
+    }
+
+    GapBuffer(GapBuffer &&other) : GapBuffer()
+    {
+        *this = std::move(other);
+    }
+
+    ~GapBuffer()
+    {
+        clear();
+        delete [] storage;
+    }
+
+    GapBuffer &operator=(const GapBuffer &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (auto i = other.begin(); i != other.end(); i++)
+                append(*i);
+        }
+
+        return *this;
+    }
+
+    GapBuffer &operator=(GapBuffer &&other)
+    {
+        if (this != &other)
+        {
+            clear();
+
+            std::swap(bufCapacity, other.bufCapacity);
+            std::swap(gapBegin, other.gapBegin);
+            std::swap(gapEnd, other.gapEnd);
+            std::swap(storage, other.storage);
+            std::swap(items, other.items);
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    size_type getSize() const
+    {
+        return bufCapacity - gapSize();
+    }
+
+    // the position of the gap, i.e. where the last edit took place
+    size_type getCursor() const
+    {
+        return gapBegin;
+    }
+
+    void append(const Type &item)
+    {
+        insertAt(getSize(), item);
+    }
+
+    void prepend(const Type &item)
+    {
+        insertAt(0, item);
+    }
+
+    void insert(const const_iterator &insertPosition, const Type &item)
+    {
+        insertAt(insertPosition.index, item);
+    }
+
+    Type popFirst()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        Type ret = *itemAt(0);
+        eraseAt(0, 1);
+        return ret;
+    }
+
+    Type popLast()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        Type ret = *itemAt(getSize() - 1);
+        eraseAt(getSize() - 1, 1);
+        return ret;
+    }
+
+    void erase(const const_iterator &position)
+    {
+        if (isEmpty() || position.index >= getSize())
+            throw std::out_of_range("Position out of range");
+
+        eraseAt(position.index, 1);
+    }
+
+    void erase(const const_iterator &firstIncluded,
+               const const_iterator &nextExcluded)
+    {
+        if (isEmpty())
+            throw std::out_of_range("Collection already empty");
+
+        eraseAt(firstIncluded.index, nextExcluded.index - firstIncluded.index);
+    }
+
+    reference operator[](size_type index)
+    {
+        if (index >= getSize())
+            throw std::out_of_range("Index out of range");
+
+        return *itemAt(index);
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        if (index >= getSize())
+            throw std::out_of_range("Index out of range");
+
+        return *itemAt(index);
+    }
+
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(this, getSize());
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, getSize());
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+
+template <typename Type>
+class GapBuffer<Type>::ConstIterator
+{
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename GapBuffer::value_type;
+    using difference_type = typename GapBuffer::difference_type;
+    using pointer = typename GapBuffer::const_pointer;
+    using reference = typename GapBuffer::const_reference;
+
+    const GapBuffer *buffer;
+    std::size_t index;
+
+    explicit ConstIterator(const GapBuffer *buffer, std::size_t index) : buffer(buffer), index(index)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (index >= buffer->getSize())
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        return *buffer->itemAt(index);
+    }
+
+    ConstIterator &operator++()
+    {
+        if (index >= buffer->getSize())
+            throw std::out_of_range("The next iterator does not exist");
+
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(buffer, index);
+        ++(*this);
+        return tmp;
+    }
+
+    ConstIterator &operator--()
+    {
+        if (index == 0)
+            throw std::out_of_range("The previous iterator does not exist");
+
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator tmp(buffer, index);
+        --(*this);
+        return tmp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        difference_type distToNext = buffer->getSize() - index;
+        if (d > distToNext)
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(buffer, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        if (d > static_cast<difference_type>(index))
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(buffer, index - d);
+    }
+
+    bool operator==(const ConstIterator &other) const
+    {
+        return buffer == other.buffer && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type>
+class GapBuffer<Type>::Iterator : public GapBuffer<Type>::ConstIterator
+{
+  public:
+    using pointer = typename GapBuffer::pointer;
+    using reference = typename GapBuffer::reference;
+
+    explicit Iterator(GapBuffer *buffer, std::size_t index) : ConstIterator(buffer, index) {}
+
+    Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+    Iterator &operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator &operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+}
+
+#endif // AISDI_LINEAR_GAPBUFFER_H
@@ -0,0 +1,397 @@
+#ifndef AISDI_LINEAR_INTRUSIVELIST_H
+#define AISDI_LINEAR_INTRUSIVELIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+class IntrusiveListHook
+{
+  public:
+    IntrusiveListHook *next;
+    IntrusiveListHook *prev;
+
+    IntrusiveListHook() : next(nullptr), prev(nullptr) {}
+
+    // copying an object must not copy its membership in a list
+    IntrusiveListHook(const IntrusiveListHook &) : IntrusiveListHook() {}
+
+    IntrusiveListHook &operator=(const IntrusiveListHook &)
+    {
+        return *this;
+    }
+
+    bool isLinked() const
+    {
+        return next != nullptr;
+    }
+};
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+class IntrusiveList
+{
+  private:
+    IntrusiveListHook sentinel;
+    std::size_t size;
+
+    static IntrusiveListHook *hookOf(Type &item)
+    {
+        return &(item.*Hook);
+    }
+
+    static std::ptrdiff_t hookOffset()
+    {
+        alignas(Type) static char probe[sizeof(Type)];
+        static const std::ptrdiff_t offset =
+            reinterpret_cast<char *>(&(reinterpret_cast<Type *>(probe)->*Hook)) - probe;
+        return offset;
+    }
+
+    static Type *ownerOf(IntrusiveListHook *hook)
+    {
+        return reinterpret_cast<Type *>(reinterpret_cast<char *>(hook) - hookOffset());
+    }
+
+    void link(IntrusiveListHook *prev, IntrusiveListHook *org, Type &item)
+    {
+        IntrusiveListHook *ptr = hookOf(item);
+        if (ptr->isLinked())
+            throw std::logic_error("Item is already linked into a list");
+
+        prev->next = ptr;
+        ptr->next = org;
+        org->prev = ptr;
+        ptr->prev = prev;
+        size++;
+    }
+
+    Type &unlink(IntrusiveListHook *ptr)
+    {
+        ptr->prev->next = ptr->next;
+        ptr->next->prev = ptr->prev;
+        ptr->next = nullptr;
+        ptr->prev = nullptr;
+        size--;
+        return *ownerOf(ptr);
+    }
+
+    void clear()
+    {
+        while (!isEmpty())
+            unlink(sentinel.next);
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type *;
+    using reference = Type &;
+    using const_pointer = const Type *;
+    using const_reference = const Type &;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    IntrusiveList() : size(0)
+    {
+        sentinel.next = &sentinel;
+        sentinel.prev = &sentinel;
+    }
+
+    IntrusiveList(const IntrusiveList &other) = delete;
+
+    IntrusiveList(IntrusiveList &&other) : IntrusiveList()
+    {
+        *this = std::move(other);
+    }
+
+    ~IntrusiveList()
+    {
+        clear();
+    }
+
+    IntrusiveList &operator=(const IntrusiveList &other) = delete;
+
+    IntrusiveList &operator=(IntrusiveList &&other)
+    {
+        if (this != &other)
+        {
+            clear();
+            if (other.isEmpty())
+                return *this;
+
+            sentinel.next = other.sentinel.next;
+            sentinel.prev = other.sentinel.prev;
+            sentinel.next->prev = &sentinel;
+            sentinel.prev->next = &sentinel;
+            size = other.size;
+
+            other.sentinel.next = &other.sentinel;
+            other.sentinel.prev = &other.sentinel;
+            other.size = 0;
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return sentinel.next == &sentinel;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    void append(Type &item)
+    {
+        link(sentinel.prev, &sentinel, item);
+    }
+
+    void prepend(Type &item)
+    {
+        link(&sentinel, sentinel.next, item);
+    }
+
+    void insert(const const_iterator &insertPosition, Type &item)
+    {
+        link(insertPosition.ptr->prev, insertPosition.ptr, item);
+    }
+
+    Type &popFirst()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        return unlink(sentinel.next);
+    }
+
+    Type &popLast()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        return unlink(sentinel.prev);
+    }
+
+    void erase(const const_iterator &position)
+    {
+        if (isEmpty() || position == cend())
+            throw std::out_of_range("Position out of range");
+
+        unlink(position.ptr);
+    }
+
+    void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded)
+    {
+        IntrusiveListHook *ptr = firstIncluded.ptr;
+        IntrusiveListHook *next;
+        while (ptr != lastExcluded.ptr)
+        {
+            if (ptr == &sentinel)
+                throw std::out_of_range("Position out of range");
+
+            next = ptr->next;
+            unlink(ptr);
+            ptr = next;
+        }
+    }
+
+    // item has to be linked into this very list, which cannot be verified in O(1)
+    void remove(Type &item)
+    {
+        if (!hookOf(item)->isLinked())
+            throw std::logic_error("Item is not linked into a list");
+
+        unlink(hookOf(item));
+    }
+
+    iterator iteratorTo(Type &item)
+    {
+        return iterator(hookOf(item), &sentinel);
+    }
+
+    iterator begin()
+    {
+        return iterator(sentinel.next, &sentinel);
+    }
+
+    iterator end()
+    {
+        return iterator(&sentinel, &sentinel);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(sentinel.next, &sentinel);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(const_cast<IntrusiveListHook *>(&sentinel), &sentinel);
+    }
+
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return cend();
+    }
+};
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+class IntrusiveList<Type, Hook>::ConstIterator
+{
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename IntrusiveList::value_type;
+    using difference_type = typename IntrusiveList::difference_type;
+    using pointer = typename IntrusiveList::const_pointer;
+    using reference = typename IntrusiveList::const_reference;
+
+    IntrusiveListHook *ptr;
+    const IntrusiveListHook *sentinel;
+
+    explicit ConstIterator(IntrusiveListHook *ptr, const IntrusiveListHook *sentinel) : ptr(ptr), sentinel(sentinel)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (ptr == sentinel)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        return *ownerOf(ptr);
+    }
+
+    ConstIterator &operator++()
+    {
+        if (ptr == sentinel)
+            throw std::out_of_range("The next iterator does not exist");
+
+        ptr = ptr->next;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(ptr, sentinel);
+        ++(*this);
+        return tmp;
+    }
+
+    ConstIterator &operator--()
+    {
+        if (ptr == sentinel->next)
+            throw std::out_of_range("The previous iterator does not exist");
+
+        ptr = ptr->prev;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator tmp(ptr, sentinel);
+        --(*this);
+        return tmp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        ConstIterator tmp(ptr, sentinel);
+        for (auto i = 0; i < d; i++)
+            ++tmp;
+        return tmp;
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        ConstIterator tmp(ptr, sentinel);
+        for (auto i = 0; i < d; i++)
+            --tmp;
+        return tmp;
+    }
+
+    bool operator==(const ConstIterator &other) const
+    {
+        return this->ptr == other.ptr;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+class IntrusiveList<Type, Hook>::Iterator : public IntrusiveList<Type, Hook>::ConstIterator
+{
+  public:
+    using pointer = typename IntrusiveList::pointer;
+    using reference = typename IntrusiveList::reference;
+
+    explicit Iterator(IntrusiveListHook *ptr, const IntrusiveListHook *sentinel) : ConstIterator(ptr, sentinel)
+    {
+    }
+
+    Iterator(const ConstIterator &other)
+        : ConstIterator(other)
+    {
+    }
+
+    Iterator &operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator &operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+}
+
+#endif // AISDI_LINEAR_INTRUSIVELIST_H
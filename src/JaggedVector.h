@@ -0,0 +1,435 @@
+#ifndef AISDI_LINEAR_JAGGEDVECTOR_H
+#define AISDI_LINEAR_JAGGEDVECTOR_H
+
+#define INIT_JAGGED_VALUES_SIZE 64 // AN ITERATION OF 2!
+#define INIT_JAGGED_ROWS_SIZE 16 // AN ITERATION OF 2!
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+// Vector of variable-length rows in compressed sparse row layout: the values
+// of all rows are stored back to back in one buffer and every row only adds
+// its end offset, instead of a whole Vector with its own heap buffer. Rows
+// are exposed as std::span, valid until the collection grows. Builder fills
+// a collection value by value when rows are produced incrementally.
+template <typename Type>
+class JaggedVector
+{
+  private:
+    Type *values;
+    std::size_t valueCount;
+    std::size_t valueCapacity;
+    std::size_t *rowEnds;
+    std::size_t rowCount;
+    std::size_t rowCapacity;
+
+    static void relocate(Type *from, Type *to)
+    {
+        new(to) Type(std::move(*from));
+        from->~Type();
+    }
+
+    void reserveValues(std::size_t required)
+    {
+        if (required <= valueCapacity)
+            return;
+
+        std::size_t newCapacity = valueCapacity ? valueCapacity : INIT_JAGGED_VALUES_SIZE;
+        while (newCapacity < required)
+            newCapacity = newCapacity << 1;
+
+        Type *newValues = reinterpret_cast<Type *>(new char[sizeof(Type) * newCapacity]);
+        for (std::size_t i = 0; i < valueCount; ++i)
+            relocate(values + i, newValues + i);
+
+        delete [] reinterpret_cast<char *>(values);
+        values = newValues;
+        valueCapacity = newCapacity;
+    }
+
+    void reserveRows(std::size_t required)
+    {
+        if (required <= rowCapacity)
+            return;
+
+        std::size_t newCapacity = rowCapacity ? rowCapacity : INIT_JAGGED_ROWS_SIZE;
+        while (newCapacity < required)
+            newCapacity = newCapacity << 1;
+
+        std::size_t *newRowEnds = new std::size_t[newCapacity];
+        for (std::size_t i = 0; i < rowCount; ++i)
+            newRowEnds[i] = rowEnds[i];
+
+        delete [] rowEnds;
+        rowEnds = newRowEnds;
+        rowCapacity = newCapacity;
+    }
+
+    std::size_t rowBegin(std::size_t row) const
+    {
+        return row == 0 ? 0 : rowEnds[row - 1];
+    }
+
+    // values appended since the last row end
+    std::size_t openRowLength() const
+    {
+        return valueCount - rowBegin(rowCount);
+    }
+
+    void appendValue(const Type &value)
+    {
+        if (valueCount == valueCapacity)
+        {
+            Type copy(value);
+            reserveValues(valueCount + 1);
+            new(values + valueCount) Type(std::move(copy));
+        }
+        else
+            new(values + valueCount) Type(value);
+        ++valueCount;
+    }
+
+    void endRow()
+    {
+        reserveRows(rowCount + 1);
+        rowEnds[rowCount] = valueCount;
+        ++rowCount;
+    }
+
+    void truncateValues(std::size_t count)
+    {
+        for (std::size_t i = count; i < valueCount; ++i)
+            values[i].~Type();
+        valueCount = count;
+    }
+
+    void clear()
+    {
+        truncateValues(0);
+        rowCount = 0;
+    }
+
+  public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using row_type = std::span<Type>;
+    using const_row_type = std::span<const Type>;
+
+    class ConstIterator;
+    class Builder;
+    using const_iterator = ConstIterator;
+
+    JaggedVector() : values(nullptr), valueCount(0), valueCapacity(0), rowEnds(nullptr), rowCount(0),
+        rowCapacity(0)
+    {
+    }
+
+    JaggedVector(std::initializer_list<std::initializer_list<Type>> l) : JaggedVector()
+    {
+        for (const std::initializer_list<Type> &row : l)
+            appendRow(row);
+    }
+
+    JaggedVector(const JaggedVector &other) : JaggedVector()
+    {
+        *this = other;
+    }
+
+    JaggedVector(JaggedVector &&other) : JaggedVector()
+    {
+        *this = std::move(other);
+    }
+
+    ~JaggedVector()
+    {
+        clear();
+        delete [] reinterpret_cast<char *>(values);
+        delete [] rowEnds;
+    }
+
+    JaggedVector &operator=(const JaggedVector &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserveValues(other.valueCount);
+            reserveRows(other.rowCount);
+
+            // a failed copy leaves the collection empty, not with values
+            // that would join the next row
+            try
+            {
+                for (std::size_t i = 0; i < other.valueCount; ++i)
+                    appendValue(other.values[i]);
+            }
+            catch (...)
+            {
+                truncateValues(0);
+                throw;
+            }
+            for (std::size_t i = 0; i < other.rowCount; ++i)
+                rowEnds[i] = other.rowEnds[i];
+            rowCount = other.rowCount;
+        }
+
+        return *this;
+    }
+
+    JaggedVector &operator=(JaggedVector &&other)
+    {
+        if (this != &other)
+        {
+            std::swap(values, other.values);
+            std::swap(valueCount, other.valueCount);
+            std::swap(valueCapacity, other.valueCapacity);
+            std::swap(rowEnds, other.rowEnds);
+            std::swap(rowCount, other.rowCount);
+            std::swap(rowCapacity, other.rowCapacity);
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return rowCount == 0;
+    }
+
+    // number of rows
+    size_type getSize() const
+    {
+        return rowCount;
+    }
+
+    // number of values in all the rows
+    size_type getValueCount() const
+    {
+        return valueCount;
+    }
+
+    void reserve(size_type rowTotal, size_type valueTotal)
+    {
+        reserveRows(rowTotal);
+        reserveValues(valueTotal);
+    }
+
+    void appendRow(const_row_type row)
+    {
+        // the row may be a part of this collection and move while growing
+        std::less<const Type *> before;
+        if (!row.empty() && !before(row.data(), values) && before(row.data(), values + valueCount))
+        {
+            std::size_t first = row.data() - values;
+            reserveValues(valueCount + row.size());
+            row = const_row_type(values + first, row.size());
+        }
+        else
+            reserveValues(valueCount + row.size());
+
+        // all or nothing, values left behind would join the next row
+        std::size_t orgValueCount = valueCount;
+        try
+        {
+            for (const Type &value : row)
+                appendValue(value);
+            endRow();
+        }
+        catch (...)
+        {
+            truncateValues(orgValueCount);
+            throw;
+        }
+    }
+
+    void appendRow(std::initializer_list<Type> row)
+    {
+        appendRow(const_row_type(row.begin(), row.size()));
+    }
+
+    void popLastRow()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        --rowCount;
+        truncateValues(rowBegin(rowCount));
+    }
+
+    row_type operator[](size_type row)
+    {
+        if (row >= rowCount)
+            throw std::out_of_range("Index out of range");
+
+        return row_type(values + rowBegin(row), rowEnds[row] - rowBegin(row));
+    }
+
+    const_row_type operator[](size_type row) const
+    {
+        if (row >= rowCount)
+            throw std::out_of_range("Index out of range");
+
+        return const_row_type(values + rowBegin(row), rowEnds[row] - rowBegin(row));
+    }
+
+    // all the values, row after row
+    const_row_type getValues() const
+    {
+        return const_row_type(values, valueCount);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, rowCount);
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+
+// Dereferencing yields a span over one row.
+template <typename Type>
+class JaggedVector<Type>::ConstIterator
+{
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename JaggedVector::const_row_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = typename JaggedVector::const_row_type;
+
+    const JaggedVector *vector;
+    std::size_t index;
+
+    explicit ConstIterator(const JaggedVector *vector, std::size_t index) : vector(vector), index(index)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (index >= vector->rowCount)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        return (*vector)[index];
+    }
+
+    ConstIterator &operator++()
+    {
+        if (index >= vector->rowCount)
+            throw std::out_of_range("The next iterator does not exist");
+
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(vector, index);
+        ++(*this);
+        return tmp;
+    }
+
+    ConstIterator &operator--()
+    {
+        if (index == 0)
+            throw std::out_of_range("The previous iterator does not exist");
+
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator tmp(vector, index);
+        --(*this);
+        return tmp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        difference_type distToNext = vector->rowCount - index;
+        if (d > distToNext)
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        if (d > static_cast<difference_type>(index))
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index - d);
+    }
+
+    bool operator==(const ConstIterator &other) const
+    {
+        return vector == other.vector && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// Builds a collection value by value: append() adds to the open row and
+// endRow() closes it. With the totals known up front the buffers are
+// allocated only once.
+template <typename Type>
+class JaggedVector<Type>::Builder
+{
+  private:
+    JaggedVector collection;
+
+  public:
+    Builder() = default;
+
+    Builder(std::size_t expectedRows, std::size_t expectedValues)
+    {
+        collection.reserve(expectedRows, expectedValues);
+    }
+
+    // number of rows closed so far
+    std::size_t getSize() const
+    {
+        return collection.rowCount;
+    }
+
+    Builder &append(const Type &value)
+    {
+        collection.appendValue(value);
+        return *this;
+    }
+
+    Builder &endRow()
+    {
+        collection.endRow();
+        return *this;
+    }
+
+    // Values appended after the last endRow() become the last row.
+    JaggedVector build()
+    {
+        if (collection.openRowLength() > 0)
+            collection.endRow();
+
+        return std::move(collection);
+    }
+};
+}
+
+#endif // AISDI_LINEAR_JAGGEDVECTOR_H
@@ -1,6 +1,10 @@
 #ifndef AISDI_LINEAR_LINKEDLIST_H
 #define AISDI_LINEAR_LINKEDLIST_H
 
+#ifndef PREFETCH_DISTANCE
+#define PREFETCH_DISTANCE 4 // NODES FETCHED AHEAD OF THE TRAVERSAL
+#endif
+
 #include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
@@ -34,6 +38,44 @@ class LinkedList
         first = sentinel;
     }
 
+    static void prefetch(const Node *node)
+    {
+#if defined(__GNUC__)
+        __builtin_prefetch(node);
+#else
+        (void) node;
+#endif
+    }
+
+    // Unchecked walk over the nodes, keeping a second cursor Distance nodes
+    // ahead of the current one so its cache line is already requested.
+    template <std::size_t Distance, typename Predicate>
+    Node *traverse(Predicate pred) const
+    {
+        Node *ahead = first;
+        for (std::size_t i = 0; i < Distance && ahead != sentinel; ++i)
+        {
+            ahead = ahead->next;
+            prefetch(ahead);
+        }
+
+        // ahead moves only along with ptr, so it stays exactly Distance nodes
+        // in front of it
+        for (Node *ptr = first; ptr != sentinel; ptr = ptr->next)
+        {
+            if (pred(*(ptr->data)))
+                return ptr;
+
+            if (ahead != sentinel)
+            {
+                ahead = ahead->next;
+                prefetch(ahead);
+            }
+        }
+
+        return sentinel;
+    }
+
   public:
     using difference_type = std::ptrdiff_t;
     using size_type = std::size_t;
@@ -256,6 +298,44 @@ class LinkedList
         last->prev = beg;
     }
 
+    template <std::size_t Distance = PREFETCH_DISTANCE, typename Function>
+    void forEach(Function f)
+    {
+        traverse<Distance>([&f](Type &item) { f(item); return false; });
+    }
+
+    template <std::size_t Distance = PREFETCH_DISTANCE, typename Function>
+    void forEach(Function f) const
+    {
+        traverse<Distance>([&f](const Type &item) { f(item); return false; });
+    }
+
+    template <std::size_t Distance = PREFETCH_DISTANCE, typename Result, typename BinaryOperation>
+    Result accumulate(Result init, BinaryOperation op) const
+    {
+        traverse<Distance>([&init, &op](const Type &item) { init = op(init, item); return false; });
+        return init;
+    }
+
+    template <std::size_t Distance = PREFETCH_DISTANCE, typename Result>
+    Result accumulate(Result init) const
+    {
+        traverse<Distance>([&init](const Type &item) { init = init + item; return false; });
+        return init;
+    }
+
+    template <std::size_t Distance = PREFETCH_DISTANCE, typename Predicate>
+    iterator findIf(Predicate pred)
+    {
+        return iterator(traverse<Distance>([&pred](Type &item) { return static_cast<bool>(pred(item)); }), sentinel);
+    }
+
+    template <std::size_t Distance = PREFETCH_DISTANCE, typename Predicate>
+    const_iterator findIf(Predicate pred) const
+    {
+        return const_iterator(traverse<Distance>([&pred](const Type &item) { return static_cast<bool>(pred(item)); }), sentinel);
+    }
+
     iterator begin()
     {
         return iterator(first, sentinel);
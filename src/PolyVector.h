@@ -0,0 +1,398 @@
+#ifndef AISDI_LINEAR_POLYVECTOR_H
+#define AISDI_LINEAR_POLYVECTOR_H
+
+#define INIT_POLY_SIZE 1024 // AN ITERATION OF 2!
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi
+{
+
+// Vector of objects of different types derived from Base, stored back to
+// back in one raw char buffer instead of behind one pointer each. Every
+// object is preceded by a small header with its type operations, the offset
+// of the object and the distance to the next header; iteration walks the
+// headers and yields Base&. Only forward iteration is supported.
+template <typename Base>
+class PolyVector
+{
+  private:
+    struct Operations
+    {
+        void (*relocate)(char *from, char *to);
+        void (*copy)(const char *from, char *to);
+        void (*destroy)(char *object);
+        Base *(*toBase)(char *object);
+    };
+
+    struct Header
+    {
+        const Operations *operations;
+        std::uint32_t objectOffset;
+        std::uint32_t stride;
+    };
+
+    template <typename Derived>
+    static Derived *objectAt(char *place)
+    {
+        return std::launder(reinterpret_cast<Derived *>(place));
+    }
+
+    template <typename Derived>
+    static void relocateItem(char *from, char *to)
+    {
+        new(to) Derived(std::move(*objectAt<Derived>(from)));
+        objectAt<Derived>(from)->~Derived();
+    }
+
+    template <typename Derived>
+    static void copyItem(const char *from, char *to)
+    {
+        if constexpr (std::is_copy_constructible<Derived>::value)
+            new(to) Derived(*objectAt<Derived>(const_cast<char *>(from)));
+    }
+
+    template <typename Derived>
+    static void destroyItem(char *object)
+    {
+        objectAt<Derived>(object)->~Derived();
+    }
+
+    template <typename Derived>
+    static Base *baseOf(char *object)
+    {
+        return objectAt<Derived>(object);
+    }
+
+    // one table per item type, items without a copy constructor get no copy
+    template <typename Derived>
+    static constexpr Operations operationsOf = {
+        &relocateItem<Derived>,
+        std::is_copy_constructible<Derived>::value ? &copyItem<Derived> : nullptr,
+        &destroyItem<Derived>,
+        &baseOf<Derived>
+    };
+
+    char *buffer;
+    std::size_t used;
+    std::size_t bufCapacity;
+    std::size_t size;
+
+    static std::size_t alignUp(std::size_t position, std::size_t alignment)
+    {
+        return (position + alignment - 1) / alignment * alignment;
+    }
+
+    Header *headerAt(std::size_t position) const
+    {
+        return std::launder(reinterpret_cast<Header *>(buffer + position));
+    }
+
+    Base *baseAt(std::size_t position) const
+    {
+        const Header *header = headerAt(position);
+        return header->operations->toBase(buffer + position + header->objectOffset);
+    }
+
+    // Records keep their offsets, which stay aligned as every buffer is
+    // aligned for any fundamental type.
+    void relocateAll(char *newBuffer)
+    {
+        for (std::size_t position = 0; position < used; position += headerAt(position)->stride)
+        {
+            const Header *header = headerAt(position);
+            new(newBuffer + position) Header(*header);
+            header->operations->relocate(buffer + position + header->objectOffset,
+                                         newBuffer + position + header->objectOffset);
+        }
+    }
+
+    std::size_t grownCapacity(std::size_t requiredSize) const
+    {
+        std::size_t newCapacity = bufCapacity ? bufCapacity : INIT_POLY_SIZE;
+        while (newCapacity < requiredSize)
+            newCapacity = newCapacity << 1;
+        return newCapacity;
+    }
+
+    void replaceBuffer(char *newBuffer, std::size_t newCapacity)
+    {
+        relocateAll(newBuffer);
+        delete [] buffer;
+        buffer = newBuffer;
+        bufCapacity = newCapacity;
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Base;
+    using reference = Base &;
+    using const_reference = const Base &;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    PolyVector() : buffer(nullptr), used(0), bufCapacity(0), size(0) {}
+
+    PolyVector(const PolyVector &other) : PolyVector()
+    {
+        *this = other;
+    }
+
+    PolyVector(PolyVector &&other) : PolyVector()
+    {
+        *this = std::move(other);
+    }
+
+    ~PolyVector()
+    {
+        clear();
+        delete [] buffer;
+    }
+
+    PolyVector &operator=(const PolyVector &other)
+    {
+        if (this != &other)
+        {
+            for (std::size_t position = 0; position < other.used; position += other.headerAt(position)->stride)
+                if (other.headerAt(position)->operations->copy == nullptr)
+                    throw std::logic_error("Collection holds items that cannot be copied");
+
+            clear();
+            reserve(other.used);
+            for (std::size_t position = 0; position < other.used; position += other.headerAt(position)->stride)
+            {
+                const Header *header = other.headerAt(position);
+                new(buffer + position) Header(*header);
+                header->operations->copy(other.buffer + position + header->objectOffset,
+                                         buffer + position + header->objectOffset);
+                used = position + header->stride;
+                ++size;
+            }
+        }
+
+        return *this;
+    }
+
+    PolyVector &operator=(PolyVector &&other)
+    {
+        if (this != &other)
+        {
+            std::swap(buffer, other.buffer);
+            std::swap(used, other.used);
+            std::swap(bufCapacity, other.bufCapacity);
+            std::swap(size, other.size);
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    // bytes taken by the objects, their headers and padding
+    size_type getUsedBytes() const
+    {
+        return used;
+    }
+
+    void reserve(size_type bytes)
+    {
+        if (bytes <= bufCapacity)
+            return;
+
+        std::size_t newCapacity = grownCapacity(bytes);
+        replaceBuffer(new char[newCapacity], newCapacity);
+    }
+
+    template <typename Derived, typename... Args>
+    Derived &emplace(Args &&...args)
+    {
+        static_assert(std::is_base_of<Base, Derived>::value, "Items have to derive from Base");
+        static_assert(alignof(Derived) <= alignof(std::max_align_t), "Over-aligned items are not supported");
+
+        std::size_t objectPosition = alignUp(used + sizeof(Header), alignof(Derived));
+        std::size_t next = alignUp(objectPosition + sizeof(Derived), alignof(Header));
+
+        Derived *object;
+        if (next > bufCapacity)
+        {
+            // args may refer to items of this collection, so the new item
+            // is built before the old ones are moved
+            std::size_t newCapacity = grownCapacity(next);
+            char *newBuffer = new char[newCapacity];
+            try
+            {
+                object = new(newBuffer + objectPosition) Derived(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                delete [] newBuffer;
+                throw;
+            }
+            replaceBuffer(newBuffer, newCapacity);
+        }
+        else
+            object = new(buffer + objectPosition) Derived(std::forward<Args>(args)...);
+
+        new(buffer + used) Header{ &operationsOf<Derived>, std::uint32_t(objectPosition - used),
+                                   std::uint32_t(next - used) };
+        used = next;
+        ++size;
+        return *object;
+    }
+
+    template <typename Derived>
+    void append(Derived &&item)
+    {
+        emplace<std::decay_t<Derived>>(std::forward<Derived>(item));
+    }
+
+    void clear()
+    {
+        for (std::size_t position = 0; position < used; position += headerAt(position)->stride)
+        {
+            const Header *header = headerAt(position);
+            header->operations->destroy(buffer + position + header->objectOffset);
+        }
+        used = 0;
+        size = 0;
+    }
+
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(this, used);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, used);
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+
+template <typename Base>
+class PolyVector<Base>::ConstIterator
+{
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename PolyVector::value_type;
+    using difference_type = typename PolyVector::difference_type;
+    using pointer = const Base *;
+    using reference = typename PolyVector::const_reference;
+
+    const PolyVector *vector;
+    std::size_t position;
+
+    explicit ConstIterator(const PolyVector *vector = nullptr, std::size_t position = 0)
+        : vector(vector), position(position)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (vector == nullptr || position >= vector->used)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        return *vector->baseAt(position);
+    }
+
+    pointer operator->() const
+    {
+        return &this->operator*();
+    }
+
+    ConstIterator &operator++()
+    {
+        if (vector == nullptr || position >= vector->used)
+            throw std::out_of_range("The next iterator does not exist");
+
+        position += vector->headerAt(position)->stride;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(vector, position);
+        ++(*this);
+        return tmp;
+    }
+
+    bool operator==(const ConstIterator &other) const
+    {
+        return vector == other.vector && position == other.position;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Base>
+class PolyVector<Base>::Iterator : public PolyVector<Base>::ConstIterator
+{
+  public:
+    using pointer = Base *;
+    using reference = typename PolyVector::reference;
+
+    explicit Iterator(PolyVector *vector = nullptr, std::size_t position = 0) : ConstIterator(vector, position) {}
+
+    Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+    Iterator &operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    pointer operator->() const
+    {
+        return &this->operator*();
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+}
+
+#endif // AISDI_LINEAR_POLYVECTOR_H
@@ -0,0 +1,355 @@
+#ifndef AISDI_LINEAR_PRIORITYQUEUE_H
+#define AISDI_LINEAR_PRIORITYQUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "Vector.h"
+
+namespace aisdi
+{
+
+// Implicit d-ary heap kept in an aisdi::Vector, shared by the queues below.
+// Items are moved into a travelling hole instead of being swapped, and
+// place(item, position) is called for every item that lands somewhere new.
+template <typename Item, typename Compare, std::size_t Arity>
+class HeapStorage
+{
+    static_assert(Arity >= 2, "A heap node needs at least two children");
+
+  public:
+    Vector<Item> items;
+    Compare before;
+
+    explicit HeapStorage(const Compare &before) : items(), before(before) {}
+
+    template <typename Place>
+    void siftUp(std::size_t position, Item item, Place place)
+    {
+        Item *heap = &items[0];
+        while (position > 0)
+        {
+            std::size_t parent = (position - 1) / Arity;
+            if (!before(heap[parent], item))
+                break;
+
+            heap[position] = std::move(heap[parent]);
+            place(heap[position], position);
+            position = parent;
+        }
+
+        heap[position] = std::move(item);
+        place(heap[position], position);
+    }
+
+    template <typename Place>
+    void siftDown(std::size_t position, Item item, Place place)
+    {
+        Item *heap = &items[0];
+        std::size_t count = items.getSize();
+        while (position * Arity + 1 < count)
+        {
+            std::size_t first = position * Arity + 1;
+            std::size_t last = std::min(first + Arity, count);
+            std::size_t best = first;
+            for (std::size_t child = first + 1; child < last; ++child)
+                if (before(heap[best], heap[child]))
+                    best = child;
+
+            if (!before(item, heap[best]))
+                break;
+
+            heap[position] = std::move(heap[best]);
+            place(heap[position], position);
+            position = best;
+        }
+
+        heap[position] = std::move(item);
+        place(heap[position], position);
+    }
+
+    // puts the item at position back in order, whichever way it has to go
+    template <typename Place>
+    void fix(std::size_t position, Place place)
+    {
+        Item item = std::move(items[position]);
+        if (position > 0 && before(items[(position - 1) / Arity], item))
+            siftUp(position, std::move(item), place);
+        else
+            siftDown(position, std::move(item), place);
+    }
+
+    template <typename Place>
+    void push(Item &&item, Place place)
+    {
+        items.append(std::move(item));
+        std::size_t last = items.getSize() - 1;
+        siftUp(last, std::move(items[last]), place);
+    }
+
+    // removes the item at position, the last item fills its place
+    template <typename Place>
+    Item remove(std::size_t position, Place place)
+    {
+        Item ret = std::move(items[position]);
+        Item last = items.popLast();
+        if (position < items.getSize())
+        {
+            items[position] = std::move(last);
+            fix(position, place);
+        }
+        return ret;
+    }
+
+    // Floyd's bottom-up construction, O(n)
+    template <typename Place>
+    void heapify(Place place)
+    {
+        std::size_t count = items.getSize();
+        for (std::size_t i = count > 1 ? (count - 2) / Arity + 1 : 0; i > 0; --i)
+            siftDown(i - 1, std::move(items[i - 1]), place);
+    }
+};
+
+// Queue handing out its highest ranked item first, as std::priority_queue:
+// with the default std::less the largest item is on top, std::greater makes
+// it a min-queue. Arity sets the number of children of a heap node; wider
+// nodes make the heap shallower and keep siblings in one cache line.
+template <typename Type, typename Compare = std::less<Type>, std::size_t Arity = 2>
+class PriorityQueue
+{
+  private:
+    HeapStorage<Type, Compare, Arity> heap;
+
+    struct Unplaced
+    {
+        void operator()(const Type &, std::size_t) const {}
+    };
+
+  public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using const_reference = const Type &;
+
+    explicit PriorityQueue(const Compare &compare = Compare()) : heap(compare) {}
+
+    PriorityQueue(std::initializer_list<Type> l, const Compare &compare = Compare()) : heap(compare)
+    {
+        heapify(l.begin(), l.end());
+    }
+
+    template <typename InputIterator>
+    PriorityQueue(InputIterator first, InputIterator last, const Compare &compare = Compare()) : heap(compare)
+    {
+        heapify(first, last);
+    }
+
+    bool isEmpty() const
+    {
+        return heap.items.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return heap.items.getSize();
+    }
+
+    const_reference top() const
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        return heap.items[0];
+    }
+
+    void push(const Type &item)
+    {
+        heap.push(Type(item), Unplaced());
+    }
+
+    void push(Type &&item)
+    {
+        heap.push(std::move(item), Unplaced());
+    }
+
+    template <typename... Args>
+    void emplace(Args &&...args)
+    {
+        heap.push(Type(std::forward<Args>(args)...), Unplaced());
+    }
+
+    Type pop()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        return heap.remove(0, Unplaced());
+    }
+
+    // Adds a whole range and restores the order once, in O(n) rather than
+    // O(n log n) for pushing the items one by one.
+    template <typename InputIterator>
+    void heapify(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+            heap.items.append(*first);
+        heap.heapify(Unplaced());
+    }
+};
+
+// The 4-ary heap is usually the fastest for pushes and pops alike.
+template <typename Type, typename Compare = std::less<Type>, std::size_t Arity = 4>
+using DaryHeap = PriorityQueue<Type, Compare, Arity>;
+
+// Priority queue whose items can be reached through the handles returned by
+// push, to change their keys (as decreaseKey in Dijkstra's algorithm) or
+// erase them. A handle is valid until its item leaves the queue, then it is
+// reused for a later push.
+template <typename Type, typename Compare = std::less<Type>, std::size_t Arity = 2>
+class IndexedPriorityQueue
+{
+  public:
+    using Handle = std::size_t;
+
+  private:
+    struct Entry
+    {
+        Type value;
+        Handle handle;
+    };
+
+    struct EntryCompare
+    {
+        Compare before;
+
+        bool operator()(const Entry &first, const Entry &second) const
+        {
+            return before(first.value, second.value);
+        }
+    };
+
+    static constexpr std::size_t notQueued = SIZE_MAX;
+
+    HeapStorage<Entry, EntryCompare, Arity> heap;
+    Vector<std::size_t> positions;
+    Vector<Handle> freeHandles;
+
+    auto placer()
+    {
+        return [this](const Entry &entry, std::size_t position) { positions[entry.handle] = position; };
+    }
+
+    std::size_t positionOf(Handle handle) const
+    {
+        if (!contains(handle))
+            throw std::out_of_range("Handle is not valid");
+
+        return positions[handle];
+    }
+
+    Type take(std::size_t position)
+    {
+        Entry entry = heap.remove(position, placer());
+        positions[entry.handle] = notQueued;
+        freeHandles.append(entry.handle);
+        return std::move(entry.value);
+    }
+
+  public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using const_reference = const Type &;
+
+    explicit IndexedPriorityQueue(const Compare &compare = Compare()) : heap(EntryCompare{ compare }) {}
+
+    bool isEmpty() const
+    {
+        return heap.items.isEmpty();
+    }
+
+    size_type getSize() const
+    {
+        return heap.items.getSize();
+    }
+
+    bool contains(Handle handle) const
+    {
+        return handle < positions.getSize() && positions[handle] != notQueued;
+    }
+
+    const_reference top() const
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        return heap.items[0].value;
+    }
+
+    Handle topHandle() const
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        return heap.items[0].handle;
+    }
+
+    const_reference operator[](Handle handle) const
+    {
+        return heap.items[positionOf(handle)].value;
+    }
+
+    Handle push(Type item)
+    {
+        Handle handle;
+        if (freeHandles.isEmpty())
+        {
+            handle = positions.getSize();
+            positions.append(notQueued);
+        }
+        else
+            handle = freeHandles.popLast();
+
+        heap.push(Entry{ std::move(item), handle }, placer());
+        return handle;
+    }
+
+    Type pop()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        return take(0);
+    }
+
+    Type erase(Handle handle)
+    {
+        return take(positionOf(handle));
+    }
+
+    // Moves the item towards the top: the new key may not rank below the
+    // current one, so with std::greater it has to be smaller or equal.
+    void decreaseKey(Handle handle, Type item)
+    {
+        std::size_t position = positionOf(handle);
+        if (heap.before.before(item, heap.items[position].value))
+            throw std::invalid_argument("New key ranks below the current one");
+
+        heap.siftUp(position, Entry{ std::move(item), handle }, placer());
+    }
+
+    // sets any new key
+    void update(Handle handle, Type item)
+    {
+        std::size_t position = positionOf(handle);
+        heap.items[position].value = std::move(item);
+        heap.fix(position, placer());
+    }
+};
+}
+
+#endif // AISDI_LINEAR_PRIORITYQUEUE_H
@@ -0,0 +1,286 @@
+#ifndef AISDI_LINEAR_RINGQUEUE_H
+#define AISDI_LINEAR_RINGQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi
+{
+
+// Bounded lock-free multi-producer multi-consumer queue (Vyukov). Every slot
+// carries a sequence number telling whether it is ready to be written or read
+// in the current lap, so producers and consumers only contend on their own
+// position counter. Nothing is allocated after construction. A push whose
+// copy throws still hands its slot over to the consumers, marked empty, so
+// the queue never wedges; consumers skip such slots.
+template <typename Type>
+class RingQueue
+{
+  private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        bool filled;
+        alignas(Type) char storage[sizeof(Type)];
+
+        explicit Cell(std::size_t sequence) : sequence(sequence), filled(false) {}
+
+        Type *data()
+        {
+            return reinterpret_cast<Type *>(storage);
+        }
+    };
+
+    std::size_t bufCapacity;
+    std::size_t mask;
+    char *buffer;
+    Cell *cells;
+    alignas(64) std::atomic<std::size_t> enqueuePos;
+    alignas(64) std::atomic<std::size_t> dequeuePos;
+
+    static std::size_t calcCapacity(std::size_t requiredSize)
+    {
+        std::size_t newCapacity = 2;
+        while (newCapacity < requiredSize)
+            newCapacity = newCapacity << 1;
+        return newCapacity;
+    }
+
+    static std::intptr_t distance(std::size_t sequence, std::size_t pos)
+    {
+        return static_cast<std::intptr_t>(sequence - pos);
+    }
+
+    // Claims up to maxCount consecutive cells whose sequence equals
+    // position + offset, i.e. cells that are ready in this lap.
+    std::size_t claim(std::atomic<std::size_t> &position, std::size_t offset,
+                      std::size_t maxCount, std::size_t &first)
+    {
+        std::size_t pos = position.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            std::size_t count = 0;
+            std::intptr_t diff = 0;
+            while (count < maxCount)
+            {
+                std::size_t seq = cells[(pos + count) & mask].sequence.load(std::memory_order_acquire);
+                diff = distance(seq, pos + count + offset);
+                if (diff != 0)
+                    break;
+                ++count;
+            }
+
+            if (count == 0)
+            {
+                // a negative distance means the queue is full (or empty),
+                // a positive one that another thread claimed pos meanwhile
+                if (diff < 0)
+                    return 0;
+
+                pos = position.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (position.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+            {
+                first = pos;
+                return count;
+            }
+        }
+    }
+
+    // publishes the claimed cell at pos without an item
+    void skip(std::size_t pos)
+    {
+        Cell &cell = cells[pos & mask];
+        cell.filled = false;
+        cell.sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    void fill(std::size_t pos, const Type &item)
+    {
+        Cell &cell = cells[pos & mask];
+        try
+        {
+            new(cell.storage) Type(item);
+        }
+        catch (...)
+        {
+            skip(pos);
+            throw;
+        }
+
+        cell.filled = true;
+        cell.sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    // destroys the item of the claimed cell at pos, if any, and hands the
+    // cell back to the producers
+    void release(std::size_t pos)
+    {
+        Cell &cell = cells[pos & mask];
+        if (cell.filled)
+            cell.data()->~Type();
+        cell.sequence.store(pos + mask + 1, std::memory_order_release);
+    }
+
+    // Takes the item out of the claimed cell at pos, if it has one, and
+    // hands the cell back to the producers; also when moving it out throws,
+    // in which case the item is lost.
+    template <typename Output>
+    bool drain(std::size_t pos, Output &&out)
+    {
+        bool filled = cells[pos & mask].filled;
+        try
+        {
+            if (filled)
+                out = std::move(*cells[pos & mask].data());
+        }
+        catch (...)
+        {
+            release(pos);
+            throw;
+        }
+
+        release(pos);
+        return filled;
+    }
+
+  public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using reference = Type &;
+    using const_reference = const Type &;
+
+    explicit RingQueue(std::size_t capacity) : bufCapacity(calcCapacity(capacity)), mask(bufCapacity - 1),
+        enqueuePos(0), dequeuePos(0)
+    {
+        buffer = new char[sizeof(Cell) * bufCapacity];
+        cells = reinterpret_cast<Cell *>(buffer);
+        for (std::size_t i = 0; i < bufCapacity; ++i)
+            new(&cells[i]) Cell(i);
+    }
+
+    RingQueue(const RingQueue &other) = delete;
+    RingQueue &operator=(const RingQueue &other) = delete;
+
+    ~RingQueue()
+    {
+        std::size_t last = enqueuePos.load();
+        for (std::size_t pos = dequeuePos.load(); pos != last; ++pos)
+            if (cells[pos & mask].filled)
+                cells[pos & mask].data()->~Type();
+
+        delete [] buffer;
+    }
+
+    size_type getCapacity() const
+    {
+        return bufCapacity;
+    }
+
+    // only a snapshot while other threads keep operating on the queue
+    bool isEmpty() const
+    {
+        return dequeuePos.load() == enqueuePos.load();
+    }
+
+    bool tryPush(const Type &item)
+    {
+        std::size_t pos;
+        if (!claim(enqueuePos, 0, 1, pos))
+            return false;
+
+        fill(pos, item);
+        return true;
+    }
+
+    bool tryPop(Type &item)
+    {
+        std::size_t pos;
+        do
+        {
+            if (!claim(dequeuePos, 1, 1, pos))
+                return false;
+        }
+        while (!drain(pos, item));
+
+        return true;
+    }
+
+    // Pushes the longest prefix of [first, last) that fits at once and
+    // returns its length. The range is measured before it is copied, hence
+    // forward iterators. If a copy throws, the cells claimed for the rest of
+    // the batch are handed over empty before the exception is passed on.
+    template <typename ForwardIterator>
+    size_type tryPushBatch(ForwardIterator first, ForwardIterator last)
+    {
+        static_assert(std::is_base_of<std::forward_iterator_tag,
+                          typename std::iterator_traits<ForwardIterator>::iterator_category>::value,
+                      "tryPushBatch passes over the range twice");
+
+        std::size_t maxCount = static_cast<std::size_t>(std::distance(first, last));
+        if (maxCount == 0)
+            return 0;
+
+        std::size_t pos;
+        std::size_t count = claim(enqueuePos, 0, maxCount, pos);
+        for (std::size_t i = 0; i < count; ++i, ++first)
+        {
+            try
+            {
+                fill(pos + i, *first);
+            }
+            catch (...)
+            {
+                for (std::size_t j = i + 1; j < count; ++j)
+                    skip(pos + j);
+                throw;
+            }
+        }
+
+        return count;
+    }
+
+    // Pops up to maxCount items into out and returns how many were popped;
+    // empty slots left by failed pushes are consumed without counting. If
+    // moving an item out throws, the rest of the claimed items are dropped so
+    // that their cells are handed back before the exception is passed on.
+    template <typename OutputIterator>
+    size_type tryPopBatch(OutputIterator out, size_type maxCount)
+    {
+        if (maxCount == 0)
+            return 0;
+
+        std::size_t pos;
+        std::size_t count = claim(dequeuePos, 1, maxCount, pos);
+        std::size_t popped = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            try
+            {
+                if (drain(pos + i, *out))
+                {
+                    ++out;
+                    ++popped;
+                }
+            }
+            catch (...)
+            {
+                for (std::size_t j = i + 1; j < count; ++j)
+                    release(pos + j);
+                throw;
+            }
+        }
+
+        return popped;
+    }
+};
+}
+
+#endif // AISDI_LINEAR_RINGQUEUE_H
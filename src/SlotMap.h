@@ -0,0 +1,382 @@
+#ifndef AISDI_LINEAR_SLOTMAP_H
+#define AISDI_LINEAR_SLOTMAP_H
+
+#define INIT_SLOT_MAP_SIZE 64 // AN ITERATION OF 2!
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "Vector.h"
+
+namespace aisdi
+{
+
+// Items addressed by generational handles. The items are kept dense in one
+// buffer, so iteration is contiguous (the iterators are those of
+// aisdi::Vector), and erase moves the last item into the freed place. A
+// handle names a slot, which knows where its item currently is; erasing bumps
+// the slot generation, so handles to erased items are detected as stale
+// instead of reaching whatever took their slot.
+template <typename Type>
+class SlotMap
+{
+  public:
+    struct Handle
+    {
+        std::uint32_t index;
+        std::uint32_t generation;
+
+        Handle() : index(UINT32_MAX), generation(0) {}
+
+        Handle(std::uint32_t index, std::uint32_t generation) : index(index), generation(generation) {}
+
+        bool operator==(const Handle &other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const Handle &other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+  private:
+    struct Slot
+    {
+        // position of the item, or the next free slot while free
+        std::uint32_t position;
+        std::uint32_t generation;
+    };
+
+    static const std::uint32_t noSlot = UINT32_MAX;
+
+    std::size_t size;
+    std::size_t bufCapacity;
+    Type *items;
+    std::uint32_t *itemSlots;
+    Slot *slots;
+    std::size_t slotCount;
+    std::size_t slotCapacity;
+    std::uint32_t freeSlot;
+
+    static void relocate(Type *from, Type *to)
+    {
+        new(to) Type(std::move(*from));
+        from->~Type();
+    }
+
+    void increaseSize(std::size_t requiredSize)
+    {
+        std::size_t newCapacity = bufCapacity ? bufCapacity : INIT_SLOT_MAP_SIZE;
+        while (newCapacity < requiredSize)
+            newCapacity = newCapacity << 1;
+
+        Type *newItems = reinterpret_cast<Type *>(new char[sizeof(Type) * newCapacity]);
+        std::uint32_t *newItemSlots = new std::uint32_t[newCapacity];
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            relocate(items + i, newItems + i);
+            newItemSlots[i] = itemSlots[i];
+        }
+
+        delete [] reinterpret_cast<char *>(items);
+        delete [] itemSlots;
+        items = newItems;
+        itemSlots = newItemSlots;
+        bufCapacity = newCapacity;
+    }
+
+    // adds a free slot unless there is one already; the only step of
+    // taking a slot that may throw
+    void reserveSlot()
+    {
+        if (freeSlot == noSlot)
+        {
+            if (slotCount == slotCapacity)
+            {
+                std::size_t newCapacity = slotCapacity ? slotCapacity << 1 : INIT_SLOT_MAP_SIZE;
+                Slot *newSlots = new Slot[newCapacity];
+                for (std::size_t i = 0; i < slotCount; ++i)
+                    newSlots[i] = slots[i];
+
+                delete [] slots;
+                slots = newSlots;
+                slotCapacity = newCapacity;
+            }
+            slots[slotCount] = Slot{ noSlot, 0 };
+            freeSlot = std::uint32_t(slotCount++);
+        }
+    }
+
+    // takes the free slot left by reserveSlot for the item at position
+    Handle takeSlot(std::uint32_t position)
+    {
+        std::uint32_t index = freeSlot;
+        freeSlot = slots[index].position;
+        slots[index].position = position;
+        itemSlots[position] = index;
+        return Handle(index, slots[index].generation);
+    }
+
+    // position of the item, or size when the handle is stale
+    std::size_t find(const Handle &handle) const
+    {
+        if (handle.index >= slotCount)
+            return size;
+
+        const Slot &slot = slots[handle.index];
+        if (slot.generation != handle.generation || slot.position >= size || itemSlots[slot.position] != handle.index)
+            return size;
+
+        return slot.position;
+    }
+
+    void release()
+    {
+        clear();
+        delete [] reinterpret_cast<char *>(items);
+        delete [] itemSlots;
+        delete [] slots;
+        items = nullptr;
+        itemSlots = nullptr;
+        slots = nullptr;
+        bufCapacity = 0;
+        slotCount = 0;
+        slotCapacity = 0;
+        freeSlot = noSlot;
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type *;
+    using reference = Type &;
+    using const_pointer = const Type *;
+    using const_reference = const Type &;
+
+    using iterator = typename Vector<Type>::Iterator;
+    using const_iterator = typename Vector<Type>::ConstIterator;
+
+    SlotMap() : size(0), bufCapacity(0), items(nullptr), itemSlots(nullptr), slots(nullptr), slotCount(0),
+        slotCapacity(0), freeSlot(noSlot)
+    {
+    }
+
+    // Handles of the original stay valid for the copy.
+    SlotMap(const SlotMap &other) : SlotMap()
+    {
+        *this = other;
+    }
+
+    SlotMap(SlotMap &&other) : SlotMap()
+    {
+        *this = std::move(other);
+    }
+
+    ~SlotMap()
+    {
+        release();
+    }
+
+    SlotMap &operator=(const SlotMap &other)
+    {
+        if (this != &other)
+        {
+            release();
+            if (other.bufCapacity > 0)
+                increaseSize(other.bufCapacity);
+            slots = new Slot[other.slotCapacity];
+            slotCapacity = other.slotCapacity;
+
+            // slots first, so that a copy throwing below leaves every copied
+            // item with a valid slot to be cleared through
+            for (; slotCount < other.slotCount; ++slotCount)
+                slots[slotCount] = other.slots[slotCount];
+            freeSlot = other.freeSlot;
+
+            for (; size < other.size; ++size)
+            {
+                new(items + size) Type(other.items[size]);
+                itemSlots[size] = other.itemSlots[size];
+            }
+        }
+
+        return *this;
+    }
+
+    SlotMap &operator=(SlotMap &&other)
+    {
+        if (this != &other)
+        {
+            release();
+
+            std::swap(size, other.size);
+            std::swap(bufCapacity, other.bufCapacity);
+            std::swap(items, other.items);
+            std::swap(itemSlots, other.itemSlots);
+            std::swap(slots, other.slots);
+            std::swap(slotCount, other.slotCount);
+            std::swap(slotCapacity, other.slotCapacity);
+            std::swap(freeSlot, other.freeSlot);
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    template <typename... Args>
+    Handle emplace(Args &&...args)
+    {
+        // before the item exists, there is nothing to undo if it throws
+        reserveSlot();
+
+        if (size == bufCapacity)
+        {
+            // args may refer to an item of this collection
+            Type item(std::forward<Args>(args)...);
+            increaseSize(size + 1);
+            new(items + size) Type(std::move(item));
+        }
+        else
+            new(items + size) Type(std::forward<Args>(args)...);
+
+        Handle handle = takeSlot(std::uint32_t(size));
+        ++size;
+        return handle;
+    }
+
+    Handle insert(const Type &item)
+    {
+        return emplace(item);
+    }
+
+    // The last item takes the place of the erased one, iterators to it are
+    // invalidated.
+    void erase(const Handle &handle)
+    {
+        std::size_t position = find(handle);
+        if (position == size)
+            throw std::out_of_range("Handle is not valid");
+
+        std::uint32_t last = std::uint32_t(size - 1);
+        items[position].~Type();
+        if (position != last)
+        {
+            relocate(items + last, items + position);
+            itemSlots[position] = itemSlots[last];
+            slots[itemSlots[position]].position = std::uint32_t(position);
+        }
+        --size;
+
+        Slot &slot = slots[handle.index];
+        ++slot.generation;
+        slot.position = freeSlot;
+        freeSlot = handle.index;
+    }
+
+    void erase(const const_iterator &position)
+    {
+        if (isEmpty() || position == cend())
+            throw std::out_of_range("Position out of range");
+
+        erase(getHandle(position));
+    }
+
+    void clear()
+    {
+        for (; size > 0; --size)
+        {
+            items[size - 1].~Type();
+
+            Slot &slot = slots[itemSlots[size - 1]];
+            ++slot.generation;
+            slot.position = freeSlot;
+            freeSlot = itemSlots[size - 1];
+        }
+    }
+
+    bool contains(const Handle &handle) const
+    {
+        return find(handle) != size;
+    }
+
+    reference operator[](const Handle &handle)
+    {
+        std::size_t position = find(handle);
+        if (position == size)
+            throw std::out_of_range("Handle is not valid");
+
+        return items[position];
+    }
+
+    const_reference operator[](const Handle &handle) const
+    {
+        std::size_t position = find(handle);
+        if (position == size)
+            throw std::out_of_range("Handle is not valid");
+
+        return items[position];
+    }
+
+    // nullptr for a stale handle
+    pointer tryGet(const Handle &handle)
+    {
+        std::size_t position = find(handle);
+        return position == size ? nullptr : items + position;
+    }
+
+    const_pointer tryGet(const Handle &handle) const
+    {
+        std::size_t position = find(handle);
+        return position == size ? nullptr : items + position;
+    }
+
+    Handle getHandle(const const_iterator &position) const
+    {
+        if (isEmpty() || position == cend())
+            throw std::out_of_range("Position out of range");
+
+        std::uint32_t index = itemSlots[position.ptr - items];
+        return Handle(index, slots[index].generation);
+    }
+
+    iterator begin()
+    {
+        return iterator(items, items, items + size);
+    }
+
+    iterator end()
+    {
+        return iterator(items + size, items, items + size);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(items, items, items + size);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(items + size, items, items + size);
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+}
+
+#endif // AISDI_LINEAR_SLOTMAP_H
@@ -0,0 +1,304 @@
+#ifndef AISDI_LINEAR_SMALLVECTOR_H
+#define AISDI_LINEAR_SMALLVECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "Vector.h"
+
+namespace aisdi
+{
+
+// Vector keeping its first N items inside the object. A heap buffer is only
+// allocated once the collection outgrows them. Items are contiguous in either
+// case, so the iterators are those of aisdi::Vector.
+template <typename Type, std::size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "SmallVector needs room for at least one inline item");
+
+  private:
+    size_t size;
+    size_t bufCapacity;
+    char *heapBuffer;
+    Type *bufBegin;
+    Type *next;
+    alignas(Type) char inlineBuffer[sizeof(Type) * N];
+
+    static void relocate(Type *from, Type *to)
+    {
+        new(to) Type(std::move(*from));
+        from->~Type();
+    }
+
+    void increaseSize(size_t requiredSize)
+    {
+        size_t newCapacity = bufCapacity;
+        while (newCapacity < requiredSize)
+            newCapacity = newCapacity << 1;
+
+        char *newBuf = new char[sizeof(Type) * newCapacity];
+        Type *newBegin = reinterpret_cast<Type *>(newBuf);
+        for (size_t i = 0; i < size; ++i)
+            relocate(bufBegin + i, newBegin + i);
+
+        delete [] heapBuffer;
+        heapBuffer = newBuf;
+        bufCapacity = newCapacity;
+        bufBegin = newBegin;
+        next = bufBegin + size;
+    }
+
+    // shifts the items from index on one place right and returns the gap
+    Type *openSlot(size_t index)
+    {
+        if (size == bufCapacity)
+            increaseSize(size + 1);
+
+        for (Type *ptr = next; ptr != bufBegin + index; --ptr)
+            relocate(ptr - 1, ptr);
+
+        return bufBegin + index;
+    }
+
+    // item may be an item of this collection, which opening the slot would
+    // move away, so it is copied first
+    void insertAt(size_t index, const Type &item)
+    {
+        Type copy(item);
+        new(openSlot(index)) Type(std::move(copy));
+        ++next;
+        ++size;
+    }
+
+    // destroys count items from index on and closes the gap they leave
+    void closeSlots(size_t index, size_t count)
+    {
+        if (count == 0)
+            return;
+
+        for (Type *ptr = bufBegin + index; ptr != bufBegin + index + count; ++ptr)
+            ptr->~Type();
+
+        for (Type *ptr = bufBegin + index + count; ptr != next; ++ptr)
+            relocate(ptr, ptr - count);
+
+        next -= count;
+        size -= count;
+    }
+
+    void clear()
+    {
+        closeSlots(0, size);
+    }
+
+    void release()
+    {
+        clear();
+        delete [] heapBuffer;
+        heapBuffer = nullptr;
+        bufCapacity = N;
+        bufBegin = reinterpret_cast<Type *>(inlineBuffer);
+        next = bufBegin;
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type *;
+    using reference = Type &;
+    using const_pointer = const Type *;
+    using const_reference = const Type &;
+
+    using iterator = typename Vector<Type>::Iterator;
+    using const_iterator = typename Vector<Type>::ConstIterator;
+
+    SmallVector() : size(0), bufCapacity(N), heapBuffer(nullptr)
+    {
+        bufBegin = reinterpret_cast<Type *>(inlineBuffer);
+        next = bufBegin;
+    }
+
+    SmallVector(std::initializer_list<Type> l) : SmallVector()
+    {
+        if (l.size() > N)
+            increaseSize(l.size());
+
+        for (const Type& el : l)
+            append(el);
+    }
+
+    SmallVector(const SmallVector &other) : SmallVector()
+    {
+        if (other.size > N)
+            increaseSize(other.size);
+
+        for (auto i = other.begin(); i != other.end(); i++)
+            append(*i);
+    }
+
+    SmallVector(SmallVector &&other) : SmallVector()
+    {
+        *this = std::move(other);
+    }
+
+    ~SmallVector()
+    {
+        release();
+    }
+
+    SmallVector &operator=(const SmallVector &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (auto i = other.begin(); i != other.end(); i++)
+                append(*i);
+        }
+
+        return *this;
+    }
+
+    // A heap buffer is taken over, inline items have to be moved one by one.
+    SmallVector &operator=(SmallVector &&other)
+    {
+        if (this != &other)
+        {
+            release();
+
+            if (other.heapBuffer)
+            {
+                heapBuffer = other.heapBuffer;
+                bufCapacity = other.bufCapacity;
+                bufBegin = other.bufBegin;
+                next = other.next;
+                size = other.size;
+
+                other.heapBuffer = nullptr;
+                other.bufCapacity = N;
+                other.bufBegin = reinterpret_cast<Type *>(other.inlineBuffer);
+                other.next = other.bufBegin;
+                other.size = 0;
+            }
+            else
+            {
+                for (size_t i = 0; i < other.size; ++i)
+                    relocate(other.bufBegin + i, bufBegin + i);
+
+                size = other.size;
+                next = bufBegin + size;
+                other.size = 0;
+                other.next = other.bufBegin;
+            }
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return bufBegin == next;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    bool isInline() const
+    {
+        return heapBuffer == nullptr;
+    }
+
+    void append(const Type &item)
+    {
+        if (size == bufCapacity)
+        {
+            // item may be an item of this collection
+            Type copy(item);
+            increaseSize(size + 1);
+            new(next) Type(std::move(copy));
+        }
+        else
+            new(next) Type(item);
+        ++next;
+        ++size;
+    }
+
+    void prepend(const Type &item)
+    {
+        insertAt(0, item);
+    }
+
+    void insert(const const_iterator &insertPosition, const Type &item)
+    {
+        insertAt(insertPosition.ptr - bufBegin, item);
+    }
+
+    Type popFirst()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        Type ret = *bufBegin;
+        closeSlots(0, 1);
+        return ret;
+    }
+
+    Type popLast()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        Type ret = *(next - 1);
+        closeSlots(size - 1, 1);
+        return ret;
+    }
+
+    void erase(const const_iterator &position)
+    {
+        if (isEmpty() || position == cend())
+            throw std::out_of_range("Position out of range");
+
+        closeSlots(position.ptr - bufBegin, 1);
+    }
+
+    void erase(const const_iterator &firstIncluded,
+               const const_iterator &nextExcluded)
+    {
+        if (isEmpty())
+            throw std::out_of_range("Collection already empty");
+
+        closeSlots(firstIncluded.ptr - bufBegin, nextExcluded.ptr - firstIncluded.ptr);
+    }
+
+    iterator begin()
+    {
+        return iterator(bufBegin, bufBegin, next);
+    }
+
+    iterator end()
+    {
+        return iterator(next, bufBegin, next);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(bufBegin, bufBegin, next);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(next, bufBegin, next);
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+}
+
+#endif // AISDI_LINEAR_SMALLVECTOR_H
@@ -0,0 +1,414 @@
+#ifndef AISDI_LINEAR_SOAVECTOR_H
+#define AISDI_LINEAR_SOAVECTOR_H
+
+#define INIT_SOA_SIZE 64 // AN ITERATION OF 2!
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi
+{
+
+// Vector of records stored as a struct of arrays: every field lives in its
+// own contiguous column, so a scan over one field only reads that column.
+// Items are exposed as tuples of references to the fields, and
+// getColumn<I>() gives the raw column for vectorized loops.
+template <typename... Fields>
+class SoAVector
+{
+    static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+
+  private:
+    size_t size;
+    size_t bufCapacity;
+    std::tuple<Fields *...> columns;
+
+    template <typename Function>
+    void forEachColumn(Function f)
+    {
+        std::apply([&f](auto *&...column) { (f(column), ...); }, columns);
+    }
+
+    template <typename Field>
+    static void relocate(Field *from, Field *to)
+    {
+        new(to) Field(std::move(*from));
+        from->~Field();
+    }
+
+    void increaseSize(size_t requiredSize)
+    {
+        size_t newCapacity = INIT_SOA_SIZE;
+        while (newCapacity < requiredSize)
+            newCapacity = newCapacity << 1;
+
+        forEachColumn([this, newCapacity](auto *&column) {
+            using Field = std::remove_reference_t<decltype(*column)>;
+            Field *newColumn = reinterpret_cast<Field *>(new char[sizeof(Field) * newCapacity]);
+            for (size_t i = 0; i < size; ++i)
+                relocate(column + i, newColumn + i);
+
+            delete [] reinterpret_cast<char *>(column);
+            column = newColumn;
+        });
+        bufCapacity = newCapacity;
+    }
+
+    // drops count records from index on and closes the gap they leave
+    void closeSlots(size_t index, size_t count)
+    {
+        if (count == 0)
+            return;
+
+        forEachColumn([this, index, count](auto *&column) {
+            using Field = std::remove_reference_t<decltype(*column)>;
+            for (size_t i = index; i < index + count; ++i)
+                column[i].~Field();
+            for (size_t i = index + count; i < size; ++i)
+                relocate(column + i, column + i - count);
+        });
+        size -= count;
+    }
+
+    void clear()
+    {
+        closeSlots(0, size);
+    }
+
+    void release()
+    {
+        clear();
+        forEachColumn([](auto *&column) {
+            delete [] reinterpret_cast<char *>(column);
+            column = nullptr;
+        });
+        bufCapacity = 0;
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = std::tuple<Fields...>;
+    using reference = std::tuple<Fields &...>;
+    using const_reference = std::tuple<const Fields &...>;
+
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    SoAVector() : size(0), bufCapacity(0), columns() {}
+
+    SoAVector(const SoAVector &other) : SoAVector()
+    {
+        for (auto i = other.begin(); i != other.end(); i++)
+            std::apply([this](const Fields &...values) { append(values...); }, *i);
+    }
+
+    SoAVector(SoAVector &&other) : SoAVector()
+    {
+        *this = std::move(other);
+    }
+
+    ~SoAVector()
+    {
+        release();
+    }
+
+    SoAVector &operator=(const SoAVector &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (auto i = other.begin(); i != other.end(); i++)
+                std::apply([this](const Fields &...values) { append(values...); }, *i);
+        }
+
+        return *this;
+    }
+
+    SoAVector &operator=(SoAVector &&other)
+    {
+        if (this != &other)
+        {
+            release();
+
+            std::swap(size, other.size);
+            std::swap(bufCapacity, other.bufCapacity);
+            std::swap(columns, other.columns);
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    void append(const Fields &...values)
+    {
+        if (size == bufCapacity)
+            increaseSize(size + 1);
+
+        // fields are built in order; if one copy throws, the built ones go
+        size_t built = 0;
+        try
+        {
+            std::apply([this, &built, &values...](Fields *...column) {
+                ((new(column + size) Fields(values), ++built), ...);
+            }, columns);
+        }
+        catch (...)
+        {
+            size_t field = 0;
+            forEachColumn([this, &field, built](auto *&column) {
+                using Field = std::remove_reference_t<decltype(*column)>;
+                if (field++ < built)
+                    column[size].~Field();
+            });
+            throw;
+        }
+        ++size;
+    }
+
+    value_type popLast()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        value_type ret = std::apply([this](Fields *...column) {
+            return value_type(std::move(column[size - 1])...);
+        }, columns);
+        closeSlots(size - 1, 1);
+        return ret;
+    }
+
+    void erase(const const_iterator &position)
+    {
+        if (isEmpty() || position == cend())
+            throw std::out_of_range("Position out of range");
+
+        closeSlots(position.index, 1);
+    }
+
+    void erase(const const_iterator &firstIncluded,
+               const const_iterator &nextExcluded)
+    {
+        if (isEmpty())
+            throw std::out_of_range("Collection already empty");
+
+        closeSlots(firstIncluded.index, nextExcluded.index - firstIncluded.index);
+    }
+
+    reference operator[](size_type index)
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return std::apply([index](Fields *...column) { return reference(column[index]...); }, columns);
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return std::apply([index](Fields *...column) { return const_reference(column[index]...); }, columns);
+    }
+
+    // Valid until the collection grows, nullptr while nothing was appended.
+    template <std::size_t I>
+    field_type<I> *getColumn()
+    {
+        return std::get<I>(columns);
+    }
+
+    template <std::size_t I>
+    const field_type<I> *getColumn() const
+    {
+        return std::get<I>(columns);
+    }
+
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(this, size);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, size);
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+
+// Dereferencing yields a tuple of references (a proxy), not a reference to
+// a stored record.
+template <typename... Fields>
+class SoAVector<Fields...>::ConstIterator
+{
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename SoAVector::value_type;
+    using difference_type = typename SoAVector::difference_type;
+    using pointer = void;
+    using reference = typename SoAVector::const_reference;
+
+    const SoAVector *vector;
+    std::size_t index;
+
+    explicit ConstIterator(const SoAVector *vector, std::size_t index) : vector(vector), index(index)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        return (*vector)[index];
+    }
+
+    ConstIterator &operator++()
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("The next iterator does not exist");
+
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(vector, index);
+        ++(*this);
+        return tmp;
+    }
+
+    ConstIterator &operator--()
+    {
+        if (index == 0)
+            throw std::out_of_range("The previous iterator does not exist");
+
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator tmp(vector, index);
+        --(*this);
+        return tmp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        difference_type distToNext = vector->size - index;
+        if (d > distToNext)
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        if (d > static_cast<difference_type>(index))
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index - d);
+    }
+
+    bool operator==(const ConstIterator &other) const
+    {
+        return vector == other.vector && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename... Fields>
+class SoAVector<Fields...>::Iterator : public SoAVector<Fields...>::ConstIterator
+{
+  public:
+    using reference = typename SoAVector::reference;
+
+    explicit Iterator(SoAVector *vector, std::size_t index) : ConstIterator(vector, index) {}
+
+    Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+    Iterator &operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator &operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        if (this->index >= this->vector->size)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        // ugly cast, yet reduces code duplication.
+        return (*const_cast<SoAVector *>(this->vector))[this->index];
+    }
+};
+}
+
+#endif // AISDI_LINEAR_SOAVECTOR_H
@@ -0,0 +1,355 @@
+#ifndef AISDI_LINEAR_STABLEVECTOR_H
+#define AISDI_LINEAR_STABLEVECTOR_H
+
+#define STABLE_CHUNK_SIZE 256 // AN ITERATION OF 2!
+
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+// Vector made of fixed-size chunks listed in a chunk index. Growing allocates
+// one more chunk, and when the index is full it doubles it, copying its
+// n / STABLE_CHUNK_SIZE pointers (amortized O(1)). Items never move, so
+// references and iterators stay valid while the collection grows.
+template <typename Type>
+class StableVector
+{
+  private:
+    static const std::size_t chunkShift = std::countr_zero(std::size_t(STABLE_CHUNK_SIZE));
+    static const std::size_t chunkMask = STABLE_CHUNK_SIZE - 1;
+
+    std::size_t size;
+    std::size_t chunkCount;
+    std::size_t indexCapacity;
+    char **chunks;
+
+    Type *itemAt(std::size_t index) const
+    {
+        return reinterpret_cast<Type *>(chunks[index >> chunkShift]) + (index & chunkMask);
+    }
+
+    void addChunk()
+    {
+        if (chunkCount == indexCapacity)
+        {
+            std::size_t newCapacity = indexCapacity ? indexCapacity << 1 : 1;
+            char **newChunks = new char *[newCapacity];
+            for (std::size_t i = 0; i < chunkCount; ++i)
+                newChunks[i] = chunks[i];
+
+            delete [] chunks;
+            chunks = newChunks;
+            indexCapacity = newCapacity;
+        }
+
+        chunks[chunkCount++] = new char[sizeof(Type) * STABLE_CHUNK_SIZE];
+    }
+
+    void clear()
+    {
+        while (!isEmpty())
+            popLast();
+    }
+
+    void release()
+    {
+        clear();
+        for (std::size_t i = 0; i < chunkCount; ++i)
+            delete [] chunks[i];
+        delete [] chunks;
+
+        chunks = nullptr;
+        chunkCount = 0;
+        indexCapacity = 0;
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type *;
+    using reference = Type &;
+    using const_pointer = const Type *;
+    using const_reference = const Type &;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    StableVector() : size(0), chunkCount(0), indexCapacity(0), chunks(nullptr) {}
+
+    StableVector(std::initializer_list<Type> l) : StableVector()
+    {
+        for (const Type& el : l)
+            append(el);
+    }
+
+    StableVector(const StableVector &other) : StableVector()
+    {
+        for (auto i = other.begin(); i != other.end(); i++)
+            append(*i);
+    }
+
+    StableVector(StableVector &&other) : StableVector()
+    {
+        *this = std::move(other);
+    }
+
+    ~StableVector()
+    {
+        release();
+    }
+
+    StableVector &operator=(const StableVector &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (auto i = other.begin(); i != other.end(); i++)
+                append(*i);
+        }
+
+        return *this;
+    }
+
+    StableVector &operator=(StableVector &&other)
+    {
+        if (this != &other)
+        {
+            release();
+
+            size = other.size;
+            chunkCount = other.chunkCount;
+            indexCapacity = other.indexCapacity;
+            chunks = other.chunks;
+
+            other.size = 0;
+            other.chunkCount = 0;
+            other.indexCapacity = 0;
+            other.chunks = nullptr;
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    void append(const Type &item)
+    {
+        if (size == chunkCount * STABLE_CHUNK_SIZE)
+            addChunk();
+
+        new(itemAt(size)) Type(item);
+        ++size;
+    }
+
+    // Chunks are kept after popping, so appending again does not allocate.
+    Type popLast()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        Type *ptr = itemAt(size - 1);
+        Type tmp = *ptr;
+        ptr->~Type();
+        --size;
+        return tmp;
+    }
+
+    reference operator[](size_type index)
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return *itemAt(index);
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return *itemAt(index);
+    }
+
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(this, size);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, size);
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+
+template <typename Type>
+class StableVector<Type>::ConstIterator
+{
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename StableVector::value_type;
+    using difference_type = typename StableVector::difference_type;
+    using pointer = typename StableVector::const_pointer;
+    using reference = typename StableVector::const_reference;
+
+    const StableVector *vector;
+    std::size_t index;
+
+    explicit ConstIterator(const StableVector *vector, std::size_t index) : vector(vector), index(index)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        return *vector->itemAt(index);
+    }
+
+    ConstIterator &operator++()
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("The next iterator does not exist");
+
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(vector, index);
+        ++(*this);
+        return tmp;
+    }
+
+    ConstIterator &operator--()
+    {
+        if (index == 0)
+            throw std::out_of_range("The previous iterator does not exist");
+
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator tmp(vector, index);
+        --(*this);
+        return tmp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        difference_type distToNext = vector->size - index;
+        if (d > distToNext)
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        if (d > static_cast<difference_type>(index))
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index - d);
+    }
+
+    bool operator==(const ConstIterator &other) const
+    {
+        return vector == other.vector && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type>
+class StableVector<Type>::Iterator : public StableVector<Type>::ConstIterator
+{
+  public:
+    using pointer = typename StableVector::pointer;
+    using reference = typename StableVector::reference;
+
+    explicit Iterator(StableVector *vector, std::size_t index) : ConstIterator(vector, index) {}
+
+    Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+    Iterator &operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator &operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+}
+
+#endif // AISDI_LINEAR_STABLEVECTOR_H
@@ -0,0 +1,196 @@
+#ifndef AISDI_LINEAR_STATICVECTOR_H
+#define AISDI_LINEAR_STATICVECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Vector.h"
+
+namespace aisdi
+{
+
+// Vector with a fixed capacity of N items stored inside the object. It never
+// allocates and every operation is constexpr, so it can build tables at
+// compile time. Unused slots hold default-constructed items, hence Type has
+// to be default constructible. Iterators are those of aisdi::Vector.
+template <typename Type, std::size_t N>
+class StaticVector
+{
+    static_assert(std::is_default_constructible<Type>::value,
+                  "Free slots are default-constructed, Type has to be default constructible");
+
+  private:
+    std::size_t size;
+    Type items[N];
+
+    constexpr Type *bufBegin() const
+    {
+        return const_cast<Type *>(items);
+    }
+
+    constexpr void requireRoom(std::size_t count) const
+    {
+        if (count > N - size)
+            throw std::length_error("Collection already full");
+    }
+
+    // shifts the items from index on count places right
+    constexpr void openSlots(std::size_t index, std::size_t count)
+    {
+        requireRoom(count);
+        for (std::size_t i = size; i > index; --i)
+            items[i - 1 + count] = std::move(items[i - 1]);
+        size += count;
+    }
+
+    // drops count items from index on and resets the freed slots
+    constexpr void closeSlots(std::size_t index, std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        for (std::size_t i = index; i + count < size; ++i)
+            items[i] = std::move(items[i + count]);
+        for (std::size_t i = size - count; i < size; ++i)
+            items[i] = Type();
+        size -= count;
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type *;
+    using reference = Type &;
+    using const_pointer = const Type *;
+    using const_reference = const Type &;
+
+    using iterator = typename Vector<Type>::Iterator;
+    using const_iterator = typename Vector<Type>::ConstIterator;
+
+    constexpr StaticVector() : size(0), items() {}
+
+    constexpr StaticVector(std::initializer_list<Type> l) : StaticVector()
+    {
+        requireRoom(l.size());
+        for (const Type& el : l)
+            items[size++] = el;
+    }
+
+    static constexpr size_type getCapacity()
+    {
+        return N;
+    }
+
+    constexpr bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    constexpr size_type getSize() const
+    {
+        return size;
+    }
+
+    constexpr void append(const Type &item)
+    {
+        requireRoom(1);
+        items[size++] = item;
+    }
+
+    constexpr void prepend(const Type &item)
+    {
+        openSlots(0, 1);
+        items[0] = item;
+    }
+
+    constexpr void insert(const const_iterator &insertPosition, const Type &item)
+    {
+        std::size_t index = insertPosition.ptr - bufBegin();
+        openSlots(index, 1);
+        items[index] = item;
+    }
+
+    constexpr Type popFirst()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        Type ret = std::move(items[0]);
+        closeSlots(0, 1);
+        return ret;
+    }
+
+    constexpr Type popLast()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        Type ret = std::move(items[size - 1]);
+        closeSlots(size - 1, 1);
+        return ret;
+    }
+
+    constexpr void erase(const const_iterator &position)
+    {
+        if (isEmpty() || position == cend())
+            throw std::out_of_range("Position out of range");
+
+        closeSlots(position.ptr - bufBegin(), 1);
+    }
+
+    constexpr void erase(const const_iterator &firstIncluded,
+                         const const_iterator &nextExcluded)
+    {
+        if (isEmpty())
+            throw std::out_of_range("Collection already empty");
+
+        closeSlots(firstIncluded.ptr - bufBegin(), nextExcluded.ptr - firstIncluded.ptr);
+    }
+
+    constexpr reference operator[](size_type index)
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return items[index];
+    }
+
+    constexpr const_reference operator[](size_type index) const
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return items[index];
+    }
+
+    constexpr iterator begin()
+    {
+        return iterator(bufBegin(), bufBegin(), bufBegin() + size);
+    }
+
+    constexpr iterator end()
+    {
+        return iterator(bufBegin() + size, bufBegin(), bufBegin() + size);
+    }
+
+    constexpr const_iterator cbegin() const
+    {
+        return const_iterator(bufBegin(), bufBegin(), bufBegin() + size);
+    }
+
+    constexpr const_iterator cend() const
+    {
+        return const_iterator(bufBegin() + size, bufBegin(), bufBegin() + size);
+    }
+
+    constexpr const_iterator begin() const { return cbegin(); }
+
+    constexpr const_iterator end() const { return cend(); }
+};
+}
+
+#endif // AISDI_LINEAR_STATICVECTOR_H
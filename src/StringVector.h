@@ -0,0 +1,340 @@
+#ifndef AISDI_LINEAR_STRINGVECTOR_H
+#define AISDI_LINEAR_STRINGVECTOR_H
+
+#define INIT_ARENA_SIZE 1024 // AN ITERATION OF 2!
+#define INIT_OFFSETS_SIZE 64 // AN ITERATION OF 2!
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi
+{
+
+// Vector of strings sharing one character arena. The characters of every
+// string are stored back to back and only their end offsets are kept
+// separately, so appending allocates only when the arena or the offsets run
+// out of room. Items are read as std::string_view, which stays valid until
+// the next append.
+class StringVector
+{
+  private:
+    char *arena;
+    std::size_t arenaSize;
+    std::size_t arenaCapacity;
+    std::size_t *ends;
+    std::size_t size;
+    std::size_t endsCapacity;
+
+    template <typename Item>
+    static void grow(Item *&items, std::size_t count, std::size_t &capacity, std::size_t required,
+                     std::size_t initCapacity)
+    {
+        if (required <= capacity)
+            return;
+
+        std::size_t newCapacity = capacity ? capacity : initCapacity;
+        while (newCapacity < required)
+            newCapacity = newCapacity << 1;
+
+        Item *newItems = new Item[newCapacity];
+        if (count > 0)
+            std::memcpy(newItems, items, sizeof(Item) * count);
+
+        delete [] items;
+        items = newItems;
+        capacity = newCapacity;
+    }
+
+    std::size_t beginOf(std::size_t index) const
+    {
+        return index == 0 ? 0 : ends[index - 1];
+    }
+
+    std::string_view itemAt(std::size_t index) const
+    {
+        return std::string_view(arena + beginOf(index), ends[index] - beginOf(index));
+    }
+
+    // whether item is a view of this very arena
+    bool owns(std::string_view item) const
+    {
+        std::less<const char *> before;
+        return !item.empty() && !before(item.data(), arena) && before(item.data(), arena + arenaSize);
+    }
+
+  public:
+    using size_type = std::size_t;
+    using value_type = std::string_view;
+    using const_reference = std::string_view;
+
+    class ConstIterator;
+    using const_iterator = ConstIterator;
+
+    StringVector() : arena(nullptr), arenaSize(0), arenaCapacity(0), ends(nullptr), size(0), endsCapacity(0) {}
+
+    StringVector(std::initializer_list<std::string_view> l) : StringVector()
+    {
+        appendBatch(l.begin(), l.end());
+    }
+
+    StringVector(const StringVector &other) : StringVector()
+    {
+        *this = other;
+    }
+
+    StringVector(StringVector &&other) : StringVector()
+    {
+        *this = std::move(other);
+    }
+
+    ~StringVector()
+    {
+        delete [] arena;
+        delete [] ends;
+    }
+
+    StringVector &operator=(const StringVector &other)
+    {
+        if (this != &other)
+        {
+            arenaSize = 0;
+            size = 0;
+            reserve(other.size, other.arenaSize);
+
+            if (other.arenaSize > 0)
+                std::memcpy(arena, other.arena, other.arenaSize);
+            if (other.size > 0)
+                std::memcpy(ends, other.ends, sizeof(std::size_t) * other.size);
+            arenaSize = other.arenaSize;
+            size = other.size;
+        }
+
+        return *this;
+    }
+
+    StringVector &operator=(StringVector &&other)
+    {
+        if (this != &other)
+        {
+            std::swap(arena, other.arena);
+            std::swap(arenaSize, other.arenaSize);
+            std::swap(arenaCapacity, other.arenaCapacity);
+            std::swap(ends, other.ends);
+            std::swap(size, other.size);
+            std::swap(endsCapacity, other.endsCapacity);
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    // total length of all the strings
+    size_type getCharacterCount() const
+    {
+        return arenaSize;
+    }
+
+    void reserve(size_type itemCount, size_type characterCount)
+    {
+        grow(ends, size, endsCapacity, itemCount, INIT_OFFSETS_SIZE);
+        grow(arena, arenaSize, arenaCapacity, characterCount, INIT_ARENA_SIZE);
+    }
+
+    void append(std::string_view item)
+    {
+        if (owns(item))
+        {
+            std::size_t offset = item.data() - arena;
+            reserve(size + 1, arenaSize + item.size());
+            item = std::string_view(arena + offset, item.size());
+        }
+        reserve(size + 1, arenaSize + item.size());
+        if (!item.empty())
+            std::memcpy(arena + arenaSize, item.data(), item.size());
+
+        arenaSize += item.size();
+        ends[size++] = arenaSize;
+    }
+
+    // Bulk load: with forward iterators the arena and offsets are sized
+    // once, up front. Views of this arena in such a batch would dangle once
+    // it is reallocated, so a batch holding any is copied out first.
+    template <typename InputIterator>
+    void appendBatch(InputIterator first, InputIterator last)
+    {
+        using Category = typename std::iterator_traits<InputIterator>::iterator_category;
+        if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value)
+        {
+            size_type itemCount = 0;
+            size_type characterCount = 0;
+            bool aliased = false;
+            for (InputIterator it = first; it != last; ++it)
+            {
+                std::string_view item(*it);
+                ++itemCount;
+                characterCount += item.size();
+                aliased = aliased || owns(item);
+            }
+
+            if (aliased)
+            {
+                StringVector copy;
+                copy.appendBatch(first, last);
+                appendBatch(copy.cbegin(), copy.cend());
+                return;
+            }
+            reserve(size + itemCount, arenaSize + characterCount);
+        }
+
+        for (; first != last; ++first)
+            append(std::string_view(*first));
+    }
+
+    std::string popLast()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        std::string ret(itemAt(size - 1));
+        arenaSize = beginOf(size - 1);
+        --size;
+        return ret;
+    }
+
+    std::string_view operator[](size_type index) const
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return itemAt(index);
+    }
+
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+};
+
+class StringVector::ConstIterator
+{
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::string_view;
+
+    const StringVector *vector;
+    std::size_t index;
+
+    explicit ConstIterator(const StringVector *vector, std::size_t index) : vector(vector), index(index)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        return vector->itemAt(index);
+    }
+
+    ConstIterator &operator++()
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("The next iterator does not exist");
+
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(vector, index);
+        ++(*this);
+        return tmp;
+    }
+
+    ConstIterator &operator--()
+    {
+        if (index == 0)
+            throw std::out_of_range("The previous iterator does not exist");
+
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator tmp(vector, index);
+        --(*this);
+        return tmp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        difference_type distToNext = vector->size - index;
+        if (d > distToNext)
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        if (d > static_cast<difference_type>(index))
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index - d);
+    }
+
+    bool operator==(const ConstIterator &other) const
+    {
+        return vector == other.vector && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+inline StringVector::const_iterator StringVector::cbegin() const
+{
+    return const_iterator(this, 0);
+}
+
+inline StringVector::const_iterator StringVector::cend() const
+{
+    return const_iterator(this, size);
+}
+
+inline StringVector::const_iterator StringVector::begin() const
+{
+    return cbegin();
+}
+
+inline StringVector::const_iterator StringVector::end() const
+{
+    return cend();
+}
+}
+
+#endif // AISDI_LINEAR_STRINGVECTOR_H
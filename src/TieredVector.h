@@ -0,0 +1,587 @@
+#ifndef AISDI_LINEAR_TIEREDVECTOR_H
+#define AISDI_LINEAR_TIEREDVECTOR_H
+
+#define MIN_TIER_SIZE 16 // AN ITERATION OF 2!
+
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+// Vector kept in circular blocks of blockSize ~ sqrt(n) items. Every block
+// but the last is full, so indexing is a shift and a mask. Inserting or
+// erasing shifts items inside a single block and then passes one item
+// between each pair of the following blocks, which is O(1) per block
+// thanks to the circular layout: O(sqrt n) in total instead of O(n).
+template <typename Type>
+class TieredVector
+{
+  private:
+    struct Block
+    {
+        char *buffer;
+        Type *items;
+        std::size_t head;
+        std::size_t count;
+    };
+
+    std::size_t size;
+    std::size_t blockSize;
+    std::size_t blockShift;
+    Block *blocks;
+    std::size_t blockCount;
+    std::size_t blockCapacity;
+
+    Type *slot(const Block &block, std::size_t position) const
+    {
+        return block.items + ((block.head + position) & (blockSize - 1));
+    }
+
+    Type *itemAt(std::size_t index) const
+    {
+        return slot(blocks[index >> blockShift], index & (blockSize - 1));
+    }
+
+    static void relocate(Type *from, Type *to)
+    {
+        new(to) Type(std::move(*from));
+        from->~Type();
+    }
+
+    void addBlock()
+    {
+        if (blockCount == blockCapacity)
+        {
+            std::size_t newCapacity = blockCapacity ? blockCapacity << 1 : 4;
+            Block *newBlocks = new Block[newCapacity];
+            for (std::size_t i = 0; i < blockCount; ++i)
+                newBlocks[i] = blocks[i];
+
+            delete [] blocks;
+            blocks = newBlocks;
+            blockCapacity = newCapacity;
+        }
+
+        Block &block = blocks[blockCount++];
+        block.buffer = new char[sizeof(Type) * blockSize];
+        block.items = reinterpret_cast<Type *>(block.buffer);
+        block.head = 0;
+        block.count = 0;
+    }
+
+    void removeLastBlock()
+    {
+        --blockCount;
+        delete [] blocks[blockCount].buffer;
+    }
+
+    void removeBlock(std::size_t index)
+    {
+        delete [] blocks[index].buffer;
+        for (std::size_t i = index + 1; i < blockCount; ++i)
+            blocks[i - 1] = blocks[i];
+        --blockCount;
+    }
+
+    // moves the last item of one block to the front of the next one
+    void passForward(Block &from, Block &to)
+    {
+        to.head = (to.head - 1) & (blockSize - 1);
+        relocate(slot(from, from.count - 1), slot(to, 0));
+        --from.count;
+        ++to.count;
+    }
+
+    // moves the first item of one block to the back of the previous one
+    void passBackward(Block &from, Block &to)
+    {
+        relocate(slot(from, 0), slot(to, to.count));
+        from.head = (from.head + 1) & (blockSize - 1);
+        --from.count;
+        ++to.count;
+    }
+
+    void insertIntoBlock(Block &block, std::size_t position, const Type &item)
+    {
+        for (std::size_t i = block.count; i > position; --i)
+            relocate(slot(block, i - 1), slot(block, i));
+
+        new(slot(block, position)) Type(item);
+        ++block.count;
+    }
+
+    void eraseFromBlock(Block &block, std::size_t position)
+    {
+        slot(block, position)->~Type();
+        for (std::size_t i = position + 1; i < block.count; ++i)
+            relocate(slot(block, i), slot(block, i - 1));
+
+        --block.count;
+    }
+
+    void insertAt(std::size_t index, const Type &item)
+    {
+        if (size == blockCount * blockSize)
+            addBlock();
+
+        std::size_t target = index >> blockShift;
+        for (std::size_t i = size >> blockShift; i > target; --i)
+            passForward(blocks[i - 1], blocks[i]);
+
+        insertIntoBlock(blocks[target], index & (blockSize - 1), item);
+        ++size;
+
+        if (blockCount > 2 * blockSize)
+            rebuild(blockSize << 1);
+    }
+
+    void eraseAt(std::size_t index)
+    {
+        std::size_t target = index >> blockShift;
+        std::size_t last = (size - 1) >> blockShift;
+        eraseFromBlock(blocks[target], index & (blockSize - 1));
+        for (std::size_t i = target + 1; i <= last; ++i)
+            passBackward(blocks[i], blocks[i - 1]);
+
+        --size;
+        if (blocks[last].count == 0)
+            removeLastBlock();
+
+        if (blockSize > MIN_TIER_SIZE && blockCount < blockSize / 4)
+            rebuild(blockSize >> 1);
+    }
+
+    // The erased items leave holes in at most two blocks and the blocks
+    // between those are dropped whole. The following blocks then pass the
+    // remaining deficit (count % blockSize) backward, so the cost is
+    // O(count + blockSize + deficit * blockCount) rather than O(n - index).
+    void eraseRange(std::size_t index, std::size_t count)
+    {
+        for (std::size_t i = index; i < index + count; ++i)
+            itemAt(i)->~Type();
+
+        std::size_t first = index >> blockShift;
+        std::size_t last = (index + count - 1) >> blockShift;
+        std::size_t position = index & (blockSize - 1);
+        std::size_t lastEnd = ((index + count - 1) & (blockSize - 1)) + 1;
+        if (first == last)
+        {
+            Block &block = blocks[first];
+            for (std::size_t i = lastEnd; i < block.count; ++i)
+                relocate(slot(block, i), slot(block, i - count));
+
+            block.count -= count;
+        }
+        else
+        {
+            blocks[first].count = position;
+            blocks[last].head = (blocks[last].head + lastEnd) & (blockSize - 1);
+            blocks[last].count -= lastEnd;
+            for (std::size_t i = first + 1; i < last; ++i)
+                blocks[i].count = 0;
+        }
+        size -= count;
+
+        std::size_t kept = first;
+        for (std::size_t i = first; i < blockCount; ++i)
+        {
+            if (blocks[i].count == 0)
+                delete [] blocks[i].buffer;
+            else
+                blocks[kept++] = blocks[i];
+        }
+        blockCount = kept;
+
+        std::size_t i = first;
+        while (i + 1 < blockCount)
+        {
+            while (blocks[i].count < blockSize && blocks[i + 1].count > 0)
+                passBackward(blocks[i + 1], blocks[i]);
+
+            if (blocks[i + 1].count == 0)
+                removeBlock(i + 1);
+            else
+                ++i;
+        }
+
+        std::size_t newBlockSize = blockSize;
+        while (newBlockSize > MIN_TIER_SIZE && (size + newBlockSize - 1) / newBlockSize < newBlockSize / 4)
+            newBlockSize = newBlockSize >> 1;
+        if (newBlockSize != blockSize)
+            rebuild(newBlockSize);
+    }
+
+    // Keeps blockSize around sqrt(n), the O(n) rebuild is amortized over
+    // the inserts (or erases) that made it necessary.
+    void rebuild(std::size_t newBlockSize)
+    {
+        Block *orgBlocks = blocks;
+        std::size_t orgBlockCount = blockCount;
+        std::size_t orgBlockSize = blockSize;
+
+        blockSize = newBlockSize;
+        blockShift = std::countr_zero(blockSize);
+        blocks = nullptr;
+        blockCount = 0;
+        blockCapacity = 0;
+
+        for (std::size_t i = 0; i < orgBlockCount; ++i)
+        {
+            Block &block = orgBlocks[i];
+            for (std::size_t j = 0; j < block.count; ++j)
+            {
+                if (blockCount == 0 || blocks[blockCount - 1].count == blockSize)
+                    addBlock();
+
+                Block &last = blocks[blockCount - 1];
+                relocate(block.items + ((block.head + j) & (orgBlockSize - 1)), slot(last, last.count));
+                ++last.count;
+            }
+
+            delete [] block.buffer;
+        }
+
+        delete [] orgBlocks;
+    }
+
+    void clear()
+    {
+        while (!isEmpty())
+        {
+            itemAt(size - 1)->~Type();
+            --size;
+        }
+
+        while (blockCount > 0)
+            removeLastBlock();
+        delete [] blocks;
+
+        blocks = nullptr;
+        blockCapacity = 0;
+        blockSize = MIN_TIER_SIZE;
+        blockShift = std::countr_zero(blockSize);
+    }
+
+  public:
+    using difference_type = std::ptrdiff_t;
+    using size_type = std::size_t;
+    using value_type = Type;
+    using pointer = Type *;
+    using reference = Type &;
+    using const_pointer = const Type *;
+    using const_reference = const Type &;
+
+    class ConstIterator;
+    class Iterator;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+
+    TieredVector() : size(0), blockSize(MIN_TIER_SIZE), blockShift(std::countr_zero(blockSize)), blocks(nullptr),
+        blockCount(0), blockCapacity(0)
+    {
+    }
+
+    TieredVector(std::initializer_list<Type> l) : TieredVector()
+    {
+        for (const Type& el : l)
+            append(el);
+    }
+
+    TieredVector(const TieredVector &other) : TieredVector()
+    {
+        for (auto i = other.begin(); i != other.end(); i++)
+            append(*i);
+    }
+
+    TieredVector(TieredVector &&other) : TieredVector()
+    {
+        *this = std::move(other);
+    }
+
+    ~TieredVector()
+    {
+        clear();
+    }
+
+    TieredVector &operator=(const TieredVector &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            for (auto i = other.begin(); i != other.end(); i++)
+                append(*i);
+        }
+
+        return *this;
+    }
+
+    TieredVector &operator=(TieredVector &&other)
+    {
+        if (this != &other)
+        {
+            clear();
+
+            std::swap(size, other.size);
+            std::swap(blockSize, other.blockSize);
+            std::swap(blockShift, other.blockShift);
+            std::swap(blocks, other.blocks);
+            std::swap(blockCount, other.blockCount);
+            std::swap(blockCapacity, other.blockCapacity);
+        }
+
+        return *this;
+    }
+
+    bool isEmpty() const
+    {
+        return size == 0;
+    }
+
+    size_type getSize() const
+    {
+        return size;
+    }
+
+    void append(const Type &item)
+    {
+        insertAt(size, item);
+    }
+
+    void prepend(const Type &item)
+    {
+        insertAt(0, item);
+    }
+
+    void insert(const const_iterator &insertPosition, const Type &item)
+    {
+        insertAt(insertPosition.index, item);
+    }
+
+    Type popFirst()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        Type ret = *itemAt(0);
+        eraseAt(0);
+        return ret;
+    }
+
+    Type popLast()
+    {
+        if (isEmpty())
+            throw std::logic_error("Collection already empty");
+
+        Type ret = *itemAt(size - 1);
+        eraseAt(size - 1);
+        return ret;
+    }
+
+    void erase(const const_iterator &position)
+    {
+        if (isEmpty() || position.index >= size)
+            throw std::out_of_range("Position out of range");
+
+        eraseAt(position.index);
+    }
+
+    void erase(const const_iterator &firstIncluded,
+               const const_iterator &nextExcluded)
+    {
+        if (isEmpty())
+            throw std::out_of_range("Collection already empty");
+
+        std::size_t rangeSize = nextExcluded.index - firstIncluded.index;
+        if (rangeSize == 0)
+            return;
+
+        eraseRange(firstIncluded.index, rangeSize);
+    }
+
+    reference operator[](size_type index)
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return *itemAt(index);
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return *itemAt(index);
+    }
+
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(this, size);
+    }
+
+    const_iterator cbegin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cend() const
+    {
+        return const_iterator(this, size);
+    }
+
+    const_iterator begin() const { return cbegin(); }
+
+    const_iterator end() const { return cend(); }
+};
+
+template <typename Type>
+class TieredVector<Type>::ConstIterator
+{
+  public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename TieredVector::value_type;
+    using difference_type = typename TieredVector::difference_type;
+    using pointer = typename TieredVector::const_pointer;
+    using reference = typename TieredVector::const_reference;
+
+    const TieredVector *vector;
+    std::size_t index;
+
+    explicit ConstIterator(const TieredVector *vector, std::size_t index) : vector(vector), index(index)
+    {
+    }
+
+    reference operator*() const
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("This iterator does not point to a valid item");
+
+        return *vector->itemAt(index);
+    }
+
+    ConstIterator &operator++()
+    {
+        if (index >= vector->size)
+            throw std::out_of_range("The next iterator does not exist");
+
+        ++index;
+        return *this;
+    }
+
+    ConstIterator operator++(int)
+    {
+        ConstIterator tmp(vector, index);
+        ++(*this);
+        return tmp;
+    }
+
+    ConstIterator &operator--()
+    {
+        if (index == 0)
+            throw std::out_of_range("The previous iterator does not exist");
+
+        --index;
+        return *this;
+    }
+
+    ConstIterator operator--(int)
+    {
+        ConstIterator tmp(vector, index);
+        --(*this);
+        return tmp;
+    }
+
+    ConstIterator operator+(difference_type d) const
+    {
+        difference_type distToNext = vector->size - index;
+        if (d > distToNext)
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index + d);
+    }
+
+    ConstIterator operator-(difference_type d) const
+    {
+        if (d > static_cast<difference_type>(index))
+            throw std::out_of_range("Given iterator does not exist");
+
+        return ConstIterator(vector, index - d);
+    }
+
+    bool operator==(const ConstIterator &other) const
+    {
+        return vector == other.vector && index == other.index;
+    }
+
+    bool operator!=(const ConstIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+template <typename Type>
+class TieredVector<Type>::Iterator : public TieredVector<Type>::ConstIterator
+{
+  public:
+    using pointer = typename TieredVector::pointer;
+    using reference = typename TieredVector::reference;
+
+    explicit Iterator(TieredVector *vector, std::size_t index) : ConstIterator(vector, index) {}
+
+    Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+    Iterator &operator++()
+    {
+        ConstIterator::operator++();
+        return *this;
+    }
+
+    Iterator operator++(int)
+    {
+        auto result = *this;
+        ConstIterator::operator++();
+        return result;
+    }
+
+    Iterator &operator--()
+    {
+        ConstIterator::operator--();
+        return *this;
+    }
+
+    Iterator operator--(int)
+    {
+        auto result = *this;
+        ConstIterator::operator--();
+        return result;
+    }
+
+    Iterator operator+(difference_type d) const
+    {
+        return ConstIterator::operator+(d);
+    }
+
+    Iterator operator-(difference_type d) const
+    {
+        return ConstIterator::operator-(d);
+    }
+
+    reference operator*() const
+    {
+        // ugly cast, yet reduces code duplication.
+        return const_cast<reference>(ConstIterator::operator*());
+    }
+};
+}
+
+#endif // AISDI_LINEAR_TIEREDVECTOR_H
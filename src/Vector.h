@@ -3,9 +3,14 @@
 
 #define INIT_BUFFER_SIZE 64 // AN ITERATION OF 2!
 
+#ifndef INCREMENTAL_GROWTH_STEP
+#define INCREMENTAL_GROWTH_STEP 4 // items moved out of the old buffer per append
+#endif
+
 #include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
+#include <utility>
 
 namespace aisdi
 {
@@ -21,8 +26,23 @@ class Vector
     Type *next;
     Type *bufEnd;
 
+    // Incremental growth: the items [moved, pendingEnd) are still in the old
+    // buffer, every other one is already in the current buffer.
+    struct Migration
+    {
+        char *oldBuffer;
+        Type *oldBegin;
+        size_t moved;
+        size_t pendingEnd;
+    };
+
+    // allocated only while the incremental growth mode is on
+    Migration *migration;
+
     void increaseSize(size_t requiredSize)
     {
+        finishMigration();
+
         size_t newCapacity = calcCapacity(requiredSize);
 
         char* newBuf = new char[sizeof(Type) * (newCapacity + 1)];
@@ -52,8 +72,67 @@ class Vector
         buffer = newBuf;
     }
 
+    // Makes a buffer twice as large current once the old one is full. New
+    // items go straight into it and the old ones follow a few per append.
+    void startMigration()
+    {
+        finishMigration();
+
+        size_t newCapacity = calcCapacity(size + 1);
+        char *newBuf = new char[sizeof(Type) * (newCapacity + 1)];
+
+        migration->oldBuffer = buffer;
+        migration->oldBegin = bufBegin;
+        migration->moved = 0;
+        migration->pendingEnd = size;
+
+        buffer = newBuf;
+        bufCapacity = newCapacity;
+        bufBegin = reinterpret_cast<Type *>(newBuf);
+        next = bufBegin + size;
+        bufEnd = bufBegin + bufCapacity;
+    }
+
+    void advanceMigration(size_t count)
+    {
+        Migration &m = *migration;
+        for (; count > 0 && m.moved < m.pendingEnd; --count, ++m.moved)
+        {
+            new(bufBegin + m.moved) Type(std::move(m.oldBegin[m.moved]));
+            m.oldBegin[m.moved].~Type();
+        }
+
+        if (m.oldBuffer && m.moved == m.pendingEnd)
+        {
+            delete [] m.oldBuffer;
+            m.oldBuffer = nullptr;
+            m.oldBegin = nullptr;
+            m.moved = 0;
+            m.pendingEnd = 0;
+        }
+    }
+
+    void finishMigration()
+    {
+        if (migration)
+            advanceMigration(size);
+    }
+
+    static constexpr Type *itemAt(Type *bufBegin, const Migration *migration, size_t index)
+    {
+        if (migration && index >= migration->moved && index < migration->pendingEnd)
+            return migration->oldBegin + index;
+        return bufBegin + index;
+    }
+
+    Type *itemAt(size_t index) const
+    {
+        return itemAt(bufBegin, migration, index);
+    }
+
     void clear()
     {
+        finishMigration();
         while (!isEmpty())
         {
             (next - 1)->~Type();
@@ -70,6 +149,25 @@ class Vector
         return newCapacity;
     }
 
+    template <typename Item>
+    void appendItem(Item &&item)
+    {
+        if (size == bufCapacity)
+        {
+            if (migration)
+                startMigration();
+            else
+                increaseSize(size + 1);
+        }
+
+        new(next) Type(std::forward<Item>(item));
+        ++next;
+        ++size;
+
+        if (migration)
+            advanceMigration(INCREMENTAL_GROWTH_STEP);
+    }
+
   public:
     using difference_type = std::ptrdiff_t;
     using size_type = std::size_t;
@@ -86,7 +184,7 @@ class Vector
 
     Vector() : Vector(INIT_BUFFER_SIZE) {}
 
-    Vector(size_t capacity) : size(0), bufCapacity(capacity)
+    Vector(size_t capacity) : size(0), bufCapacity(capacity), migration(nullptr)
     {
         buffer = new char[sizeof(Type) * (bufCapacity + 1)];
         bufBegin = reinterpret_cast<Type *>(buffer);
@@ -100,13 +198,16 @@ class Vector
             append(el);
     }
 
+    // indexes the other vector, so that its pending migration is left alone
     Vector(const Vector &other) : Vector(calcCapacity(other.size)) 
     {
-        for (auto i = other.begin(); i != other.end(); i++)
-            append(*i);
+        for (size_t i = 0; i < other.size; ++i)
+            append(other[i]);
+        setIncrementalGrowth(other.hasIncrementalGrowth());
     }
 
-    Vector(Vector &&other) : size(0), bufCapacity(0), buffer(nullptr), bufBegin(nullptr), next(nullptr), bufEnd(nullptr)
+    Vector(Vector &&other) : size(0), bufCapacity(0), buffer(nullptr), bufBegin(nullptr), next(nullptr), bufEnd(nullptr),
+        migration(nullptr)
     {
         *this = std::move(other);
     }
@@ -118,6 +219,7 @@ class Vector
             clear();
             delete [] buffer;
         }
+        delete migration;
     }
 
     Vector &operator=(const Vector &other)
@@ -125,8 +227,8 @@ class Vector
         if (this != &other)
         {
             clear();
-            for (auto i = other.begin(); i != other.end(); i++)
-                append(*i);
+            for (size_t i = 0; i < other.size; ++i)
+                append(other[i]);
         }
 
         return *this;
@@ -142,6 +244,9 @@ class Vector
                 delete [] buffer;
             }
 
+            other.finishMigration();
+            setIncrementalGrowth(other.hasIncrementalGrowth());
+
             size = other.size;
             bufCapacity = other.bufCapacity;
             buffer = other.buffer;
@@ -170,14 +275,38 @@ class Vector
         return size;
     }
 
+    bool hasIncrementalGrowth() const
+    {
+        return migration != nullptr;
+    }
+
+    // In the incremental growth mode no single append moves the whole
+    // buffer: the append that finds it full switches to a buffer twice as
+    // large, and the old items follow INCREMENTAL_GROWTH_STEP per append,
+    // each of them moved once. Until then both buffers are held, and
+    // operator[] and iterators look an item up in whichever one holds it.
+    // Modifications that shift items (insert, prepend, erase, popFirst) move
+    // the rest at once.
+    void setIncrementalGrowth(bool enabled)
+    {
+        if (enabled && !migration)
+            migration = new Migration{ nullptr, nullptr, 0, 0 };
+        else if (!enabled && migration)
+        {
+            finishMigration();
+            delete migration;
+            migration = nullptr;
+        }
+    }
+
     void append(const Type &item)
     {
-        if (size == bufCapacity)
-            increaseSize(size + 1);
+        appendItem(item);
+    }
 
-        new(next) Type(item);
-        ++next;
-        ++size;
+    void append(Type &&item)
+    {
+        appendItem(std::move(item));
     }
 
     void prepend(const Type &item)
@@ -188,6 +317,7 @@ class Vector
             return;
         }
 
+        finishMigration();
         if (size == bufCapacity)
             increaseSize(size + 1);
         
@@ -224,12 +354,16 @@ class Vector
             return;
         }
 
+        // growing moves the items, so the position is kept as an index
+        size_t index = insertPosition.ptr - bufBegin;
+        finishMigration();
         if (size == bufCapacity)
             increaseSize(size + 1);
 
+        Type* position = bufBegin + index;
         Type* tmp = next - 1;
         Type* tmpNext = next;
-        while (tmp != insertPosition.ptr)
+        while (tmp != position)
         {
             new(tmpNext) Type(*tmp);
             tmp->~Type();
@@ -240,7 +374,7 @@ class Vector
         new(tmpNext) Type(*tmp);
         tmp->~Type();
         
-        new(insertPosition.ptr) Type(item);
+        new(position) Type(item);
         ++next;
         ++size;
 
@@ -251,6 +385,7 @@ class Vector
         if (isEmpty())
             throw std::logic_error("Collection already empty");
 
+        finishMigration();
         Type ret = *bufBegin;
         bufBegin->~Type();
         Type* tmp = bufBegin + 1;
@@ -272,10 +407,17 @@ class Vector
         if (isEmpty())
             throw std::logic_error("Collection already empty"); 
         
-        Type tmp = *(next - 1);
-        (next - 1)->~Type();
+        Type *last = itemAt(size - 1);
+        Type tmp = std::move(*last);
+        last->~Type();
         --next;
         --size;
+
+        if (migration && migration->pendingEnd > size)
+        {
+            migration->pendingEnd = size;
+            advanceMigration(0);
+        }
         return tmp;
     }
 
@@ -284,6 +426,7 @@ class Vector
         if (isEmpty() || position == cend())
             throw std::out_of_range("Position out of range");
 
+        finishMigration();
         position.ptr->~Type();
         Type *tmp = position.ptr + 1;
         Type *tmpNext = position.ptr;
@@ -304,6 +447,7 @@ class Vector
         if (isEmpty())
             throw std::out_of_range("Collection already empty");
 
+        finishMigration();
         difference_type rangeSize = nextExcluded.ptr - firstIncluded.ptr;
 
         Type *tmp = firstIncluded.ptr + rangeSize;
@@ -322,24 +466,40 @@ class Vector
         size -= rangeSize;
     }
 
+    reference operator[](size_type index)
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return *itemAt(index);
+    }
+
+    const_reference operator[](size_type index) const
+    {
+        if (index >= size)
+            throw std::out_of_range("Index out of range");
+
+        return *itemAt(index);
+    }
+
     iterator begin() 
     {
-        return iterator(bufBegin, bufBegin, next);
+        return iterator(bufBegin, bufBegin, next, migration);
     }
 
     iterator end() 
     {
-        return iterator(next, bufBegin, next);
+        return iterator(next, bufBegin, next, migration);
     }
 
     const_iterator cbegin() const
     {
-        return const_iterator(bufBegin, bufBegin, next);
+        return const_iterator(bufBegin, bufBegin, next, migration);
     }
 
     const_iterator cend() const
     {
-        return const_iterator(next, bufBegin, next);
+        return const_iterator(next, bufBegin, next, migration);
     }
 
     const_iterator begin() const { return cbegin(); }
@@ -357,23 +517,27 @@ class Vector<Type>::ConstIterator
     using pointer = typename Vector::const_pointer;
     using reference = typename Vector::const_reference;
 
+    // ptr is the position in the current buffer; during a migration the
+    // item itself may still be in the old one, which split tells
     Type* ptr;
     Type* begin;
     Type* next;
+    const Migration* split;
 
-    explicit ConstIterator(Type* ptr, Type* begin, Type* next) : ptr(ptr), begin(begin), next(next)
+    explicit constexpr ConstIterator(Type* ptr, Type* begin, Type* next, const Migration* split = nullptr)
+        : ptr(ptr), begin(begin), next(next), split(split)
     {
     }
 
-    reference operator*() const 
+    constexpr reference operator*() const 
     {
         if (ptr == next)
             throw std::out_of_range("This iterator does not point to a valid item");
     
-        return *ptr;
+        return *Vector::itemAt(begin, split, ptr - begin);
     }
 
-    ConstIterator &operator++()
+    constexpr ConstIterator &operator++()
     {
         if (ptr == next)
             throw std::out_of_range("The next iterator does not exist");
@@ -382,14 +546,14 @@ class Vector<Type>::ConstIterator
         return *this;
     }
 
-    ConstIterator operator++(int)
+    constexpr ConstIterator operator++(int)
     {
-        ConstIterator tmp(ptr, begin, next);
+        ConstIterator tmp(*this);
         ++(*this);
         return tmp;
     }
 
-    ConstIterator &operator--()
+    constexpr ConstIterator &operator--()
     {
         if (ptr == begin)
             throw std::out_of_range("The previous iterator does not exist");
@@ -398,39 +562,39 @@ class Vector<Type>::ConstIterator
         return *this;
     }
 
-    ConstIterator operator--(int)
+    constexpr ConstIterator operator--(int)
     {
-        ConstIterator tmp(ptr, begin, next);
+        ConstIterator tmp(*this);
         --(*this);
         return tmp;
     }
 
-    ConstIterator operator+(difference_type d) const
+    constexpr ConstIterator operator+(difference_type d) const
     {
         difference_type distToNext = next - ptr;
         if (d > distToNext)
             throw std::out_of_range("Given iterator does not exist");
 
-        ConstIterator tmp(ptr + d, begin, next);
+        ConstIterator tmp(ptr + d, begin, next, split);
         return tmp;
     }
 
-    ConstIterator operator-(difference_type d) const
+    constexpr ConstIterator operator-(difference_type d) const
     {
         difference_type distToBeg = ptr - begin;
         if (d > distToBeg)
             throw std::out_of_range("Given iterator does not exist");
 
-        ConstIterator tmp(ptr - d, begin, next);
+        ConstIterator tmp(ptr - d, begin, next, split);
         return tmp;
     }
 
-    bool operator==(const ConstIterator &other) const
+    constexpr bool operator==(const ConstIterator &other) const
     {
         return this->ptr == other.ptr;
     }
 
-    bool operator!=(const ConstIterator &other) const
+    constexpr bool operator!=(const ConstIterator &other) const
     {
         return !(*this == other);
     }
@@ -443,47 +607,50 @@ class Vector<Type>::Iterator : public Vector<Type>::ConstIterator
     using pointer = typename Vector::pointer;
     using reference = typename Vector::reference;
 
-    explicit Iterator(Type* ptr, Type* begin, Type* next) : ConstIterator(ptr, begin, next) {}
+    explicit constexpr Iterator(Type* ptr, Type* begin, Type* next, const Migration* split = nullptr)
+        : ConstIterator(ptr, begin, next, split)
+    {
+    }
 
-    Iterator(const ConstIterator &other) : ConstIterator(other) {}
+    constexpr Iterator(const ConstIterator &other) : ConstIterator(other) {}
 
-    Iterator &operator++()
+    constexpr Iterator &operator++()
     {
         ConstIterator::operator++();
         return *this;
     }
 
-    Iterator operator++(int)
+    constexpr Iterator operator++(int)
     {
         auto result = *this;
         ConstIterator::operator++();
         return result;
     }
 
-    Iterator &operator--()
+    constexpr Iterator &operator--()
     {
         ConstIterator::operator--();
         return *this;
     }
 
-    Iterator operator--(int)
+    constexpr Iterator operator--(int)
     {
         auto result = *this;
         ConstIterator::operator--();
         return result;
     }
 
-    Iterator operator+(difference_type d) const
+    constexpr Iterator operator+(difference_type d) const
     {
         return ConstIterator::operator+(d);
     }
 
-    Iterator operator-(difference_type d) const
+    constexpr Iterator operator-(difference_type d) const
     {
         return ConstIterator::operator-(d);
     }
 
-    reference operator*() const
+    constexpr reference operator*() const
     {
         // ugly cast, yet reduces code duplication.
         return const_cast<reference>(ConstIterator::operator*());
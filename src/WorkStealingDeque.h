@@ -0,0 +1,189 @@
+#ifndef AISDI_LINEAR_WORKSTEALINGDEQUE_H
+#define AISDI_LINEAR_WORKSTEALINGDEQUE_H
+
+#define INIT_DEQUE_SIZE 64 // AN ITERATION OF 2!
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi
+{
+
+// Chase-Lev work-stealing deque (with the memory orders of Le et al.).
+// Only the owning thread may call append and tryPopLast, any thread may call
+// trySteal. The owner never executes an atomic read-modify-write operation
+// except when it races with thieves for the very last item.
+template <typename Type>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<Type>::value,
+                  "Thieves copy items before claiming them, Type has to be trivially copyable");
+
+  private:
+    class Array;
+
+    alignas(64) std::atomic<std::int64_t> top;
+    alignas(64) std::atomic<std::int64_t> bottom;
+    std::atomic<Array *> array;
+
+    // Thieves may still read from the array being replaced, so it is only
+    // released together with the deque.
+    Array *increaseSize(Array *org, std::int64_t first, std::int64_t last)
+    {
+        Array *ptr = new Array(org->capacity << 1, org);
+        for (std::int64_t i = first; i != last; ++i)
+            ptr->put(i, org->get(i));
+
+        array.store(ptr, std::memory_order_release);
+        return ptr;
+    }
+
+  public:
+    using size_type = std::size_t;
+    using value_type = Type;
+    using reference = Type &;
+    using const_reference = const Type &;
+
+    WorkStealingDeque() : WorkStealingDeque(INIT_DEQUE_SIZE) {}
+
+    explicit WorkStealingDeque(std::size_t capacity) : top(0), bottom(0)
+    {
+        std::size_t bufCapacity = 2;
+        while (bufCapacity < capacity)
+            bufCapacity = bufCapacity << 1;
+        array.store(new Array(bufCapacity, nullptr));
+    }
+
+    WorkStealingDeque(const WorkStealingDeque &other) = delete;
+    WorkStealingDeque &operator=(const WorkStealingDeque &other) = delete;
+
+    ~WorkStealingDeque()
+    {
+        Array *ptr = array.load();
+        while (ptr)
+        {
+            Array *previous = ptr->previous;
+            delete ptr;
+            ptr = previous;
+        }
+    }
+
+    // only a snapshot while other threads keep operating on the deque
+    bool isEmpty() const
+    {
+        return bottom.load() <= top.load();
+    }
+
+    size_type getSize() const
+    {
+        std::int64_t size = bottom.load() - top.load();
+        return size > 0 ? static_cast<size_type>(size) : 0;
+    }
+
+    void append(const Type &item)
+    {
+        std::int64_t b = bottom.load(std::memory_order_relaxed);
+        std::int64_t t = top.load(std::memory_order_acquire);
+        Array *a = array.load(std::memory_order_relaxed);
+        if (b - t > static_cast<std::int64_t>(a->capacity) - 1)
+            a = increaseSize(a, t, b);
+
+        a->put(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    bool tryPopLast(Type &item)
+    {
+        std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Array *a = array.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+
+        if (t > b)
+        {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        Type last = a->get(b);
+        if (t == b)
+        {
+            // the last item, thieves may compete for it; item is left alone
+            // when one of them wins
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            if (won)
+                item = std::move(last);
+            return won;
+        }
+
+        item = std::move(last);
+        return true;
+    }
+
+    bool trySteal(Type &item)
+    {
+        std::int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return false;
+
+        Array *a = array.load(std::memory_order_acquire);
+        Type stolen = a->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed))
+            return false;
+
+        item = std::move(stolen);
+        return true;
+    }
+};
+
+template <typename Type>
+class WorkStealingDeque<Type>::Array
+{
+  private:
+    char *buffer;
+    std::atomic<Type> *items;
+    std::size_t mask;
+
+  public:
+    std::size_t capacity;
+    Array *previous;
+
+    Array(std::size_t capacity, Array *previous) : mask(capacity - 1), capacity(capacity), previous(previous)
+    {
+        buffer = new char[sizeof(std::atomic<Type>) * capacity];
+        items = reinterpret_cast<std::atomic<Type> *>(buffer);
+        for (std::size_t i = 0; i < capacity; ++i)
+            new(&items[i]) std::atomic<Type>();
+    }
+
+    Array(const Array &other) = delete;
+    Array &operator=(const Array &other) = delete;
+
+    ~Array()
+    {
+        delete [] buffer;
+    }
+
+    Type get(std::int64_t index) const
+    {
+        return items[static_cast<std::size_t>(index) & mask].load(std::memory_order_relaxed);
+    }
+
+    void put(std::int64_t index, const Type &item)
+    {
+        items[static_cast<std::size_t>(index) & mask].store(item, std::memory_order_relaxed);
+    }
+};
+}
+
+#endif // AISDI_LINEAR_WORKSTEALINGDEQUE_H
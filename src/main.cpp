@@ -6,6 +6,7 @@
 
 #include "Vector.h"
 #include "LinkedList.h"
+#include "StringVector.h"
 
 using namespace std::chrono;
 
@@ -19,6 +20,7 @@ void perfomTest()
 {
   aisdi::LinkedList<std::string> list( {"Lorem", "ipsum", "dolor", "sit", "amet,", "consectetur", "adipiscing", "elit.", "Praesent", "posuere", "tortor", "quis", "iaculis", "dignissim.", "Vestibulum", "nec", "tortor", "malesuada,", "semper", "enim", "eu,", "faucibus", "lectus.", "Morbi", "urna", "risus,", "interdum", "in", "nisl", "eu,", "convallis", "tincidunt", "dolor.", "Nunc", "a", "augue", "dui.", "Nam", "ut", "dignissim", "odio.", "Quisque", "vitae", "lectus", "eget", "risus", "volutpat", "rutrum.", "Sed", "dignissim."} );
   aisdi::Vector<std::string> vect( {"Lorem", "ipsum", "dolor", "sit", "amet,", "consectetur", "adipiscing", "elit.", "Praesent", "posuere", "tortor", "quis", "iaculis", "dignissim.", "Vestibulum", "nec", "tortor", "malesuada,", "semper", "enim", "eu,", "faucibus", "lectus.", "Morbi", "urna", "risus,", "interdum", "in", "nisl", "eu,", "convallis", "tincidunt", "dolor.", "Nunc", "a", "augue", "dui.", "Nam", "ut", "dignissim", "odio.", "Quisque", "vitae", "lectus", "eget", "risus", "volutpat", "rutrum.", "Sed", "dignissim."} );
+  aisdi::StringVector words( {"Lorem", "ipsum", "dolor", "sit", "amet,", "consectetur", "adipiscing", "elit.", "Praesent", "posuere", "tortor", "quis", "iaculis", "dignissim.", "Vestibulum", "nec", "tortor", "malesuada,", "semper", "enim", "eu,", "faucibus", "lectus.", "Morbi", "urna", "risus,", "interdum", "in", "nisl", "eu,", "convallis", "tincidunt", "dolor.", "Nunc", "a", "augue", "dui.", "Nam", "ut", "dignissim", "odio.", "Quisque", "vitae", "lectus", "eget", "risus", "volutpat", "rutrum.", "Sed", "dignissim."} );
 
   high_resolution_clock::time_point t1 = high_resolution_clock::now();
   list.prepend("Test");
@@ -43,6 +45,18 @@ void perfomTest()
   high_resolution_clock::time_point t8 = high_resolution_clock::now();
   auto duration4 = duration_cast<microseconds>( t8 - t7 ).count();
   std::cout << "Vector get last element iterator: " << duration4 << std::endl;
+  
+  high_resolution_clock::time_point t9 = high_resolution_clock::now();
+  vect.append("Test");
+  high_resolution_clock::time_point t10 = high_resolution_clock::now();
+  auto duration5 = duration_cast<microseconds>( t10 - t9 ).count();
+  std::cout << "Vector append time: " << duration5 << std::endl;
+  
+  high_resolution_clock::time_point t11 = high_resolution_clock::now();
+  words.append("Test");
+  high_resolution_clock::time_point t12 = high_resolution_clock::now();
+  auto duration6 = duration_cast<microseconds>( t12 - t11 ).count();
+  std::cout << "StringVector append time: " << duration6 << std::endl;
 }
 
 } // namespace
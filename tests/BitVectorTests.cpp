@@ -0,0 +1,160 @@
+#include <BitVector.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+using std::begin;
+using std::end;
+
+namespace
+{
+
+void thenCollectionMatches(const aisdi::BitVector& collection, const std::vector<bool>& expected)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), begin(expected), end(expected));
+}
+
+std::size_t nextRandom(std::size_t& seed)
+{
+  seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+  return static_cast<std::size_t>(seed >> 33);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(BitVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const aisdi::BitVector collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.popcount(), 0);
+  BOOST_CHECK_EQUAL(collection.findFirstSet(), 0);
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenAssigningThroughIndex_ThenFlagChanges)
+{
+  aisdi::BitVector collection = { false, true, false };
+
+  collection[0] = true;
+  collection[1] = false;
+  collection[2] = collection[0];
+
+  thenCollectionMatches(collection, { true, false, true });
+  BOOST_CHECK_THROW(collection[3], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenModifiedThroughIterator_ThenFlagsChange)
+{
+  aisdi::BitVector collection(100, false);
+
+  for (auto it = collection.begin(); it != collection.end(); ++it)
+    *it = true;
+
+  BOOST_CHECK_EQUAL(collection.popcount(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSparseCollection_WhenSearching_ThenSetFlagsAreFound)
+{
+  aisdi::BitVector collection(1000, false);
+  collection[3] = true;
+  collection[64] = true;
+  collection[700] = true;
+
+  BOOST_CHECK_EQUAL(collection.popcount(), 3);
+  BOOST_CHECK_EQUAL(collection.findFirstSet(), 3);
+  BOOST_CHECK_EQUAL(collection.findFirstSet(4), 64);
+  BOOST_CHECK_EQUAL(collection.findFirstSet(64), 64);
+  BOOST_CHECK_EQUAL(collection.findFirstSet(65), 700);
+  BOOST_CHECK_EQUAL(collection.findFirstSet(701), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTwoCollections_WhenCombining_ThenWordsAreCombined)
+{
+  aisdi::BitVector a = { true, true, false, false };
+  const aisdi::BitVector b = { true, false, true, false };
+
+  aisdi::BitVector both(a);
+  both &= b;
+  aisdi::BitVector either(a);
+  either |= b;
+  a ^= b;
+
+  thenCollectionMatches(both, { true, false, false, false });
+  thenCollectionMatches(either, { true, true, true, false });
+  thenCollectionMatches(a, { false, true, true, false });
+  BOOST_CHECK_THROW(a &= aisdi::BitVector(5, true), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPoppingOrErasing_ThenOperationThrows)
+{
+  aisdi::BitVector collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(collection.begin()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomEdits_WhenCollectionGrowsAndShrinks_ThenItMatchesReference)
+{
+  aisdi::BitVector collection;
+  std::vector<bool> expected;
+  std::size_t seed = 7;
+
+  for (int round = 0; round < 5000; ++round)
+  {
+    std::size_t operation = nextRandom(seed) % 8;
+    bool value = nextRandom(seed) % 2;
+    if (operation < 4 || expected.empty())
+    {
+      std::size_t position = nextRandom(seed) % (expected.size() + 1);
+      collection.insert(collection.cbegin() + position, value);
+      expected.insert(expected.begin() + position, value);
+    }
+    else if (operation < 6)
+    {
+      std::size_t position = nextRandom(seed) % expected.size();
+      collection.erase(collection.cbegin() + position);
+      expected.erase(expected.begin() + position);
+    }
+    else if (operation < 7)
+    {
+      std::size_t first = nextRandom(seed) % expected.size();
+      std::size_t last = first + nextRandom(seed) % (expected.size() - first + 1);
+      collection.erase(collection.cbegin() + first, collection.cbegin() + last);
+      expected.erase(expected.begin() + first, expected.begin() + last);
+    }
+    else
+    {
+      BOOST_REQUIRE_EQUAL(collection.popLast(), expected.back());
+      expected.pop_back();
+    }
+  }
+
+  thenCollectionMatches(collection, expected);
+  std::size_t count = 0;
+  for (bool flag : expected)
+    count += flag;
+  BOOST_CHECK_EQUAL(collection.popcount(), count);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPopping_ThenEndsAreReturned)
+{
+  aisdi::BitVector collection = { true, false, false };
+
+  BOOST_CHECK(collection.popFirst());
+  BOOST_CHECK(!collection.popLast());
+  collection.prepend(true);
+  thenCollectionMatches(collection, { true, false });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,314 @@
+#include <Channel.h>
+
+#include <coroutine>
+#include <cstddef>
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+// fire-and-forget coroutine running eagerly until its first suspension
+struct Task
+{
+  struct promise_type
+  {
+    Task get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+Task sendAll(aisdi::Channel<int>& channel, int first, int last, int& sent)
+{
+  for (int i = first; i < last; ++i)
+  {
+    co_await channel.send(i);
+    ++sent;
+  }
+}
+
+Task receiveAll(aisdi::Channel<int>& channel, aisdi::Vector<int>& received)
+{
+  while (auto item = co_await channel.receive())
+    received.append(*item);
+}
+
+Task sendUntilClosed(aisdi::Channel<int>& channel, int& sent, bool& failed)
+{
+  try
+  {
+    for (;;)
+    {
+      co_await channel.send(sent);
+      ++sent;
+    }
+  }
+  catch (const std::logic_error&)
+  {
+    failed = true;
+  }
+}
+
+Task receiveBatches(aisdi::Channel<int>& channel, std::size_t maxCount,
+                    aisdi::Vector<std::size_t>& batchSizes)
+{
+  for (;;)
+  {
+    auto batch = co_await channel.receiveBatch(maxCount);
+    if (batch.isEmpty())
+      break;
+    batchSizes.append(batch.getSize());
+  }
+}
+
+// counts the copies made of it, moving is free
+struct CopyCounted
+{
+  static int copies;
+
+  CopyCounted() = default;
+
+  CopyCounted(const CopyCounted&)
+  {
+    ++copies;
+  }
+
+  CopyCounted(CopyCounted&&) = default;
+
+  CopyCounted& operator=(const CopyCounted&)
+  {
+    ++copies;
+    return *this;
+  }
+
+  CopyCounted& operator=(CopyCounted&&) = default;
+};
+
+int CopyCounted::copies = 0;
+
+Task sendTemporaries(aisdi::Channel<CopyCounted>& channel, int count)
+{
+  for (int i = 0; i < count; ++i)
+    co_await channel.send(CopyCounted());
+}
+
+Task receiveCountedBatches(aisdi::Channel<CopyCounted>& channel, std::size_t& received)
+{
+  for (;;)
+  {
+    auto batch = co_await channel.receiveBatch(4);
+    if (batch.isEmpty())
+      break;
+    received += batch.getSize();
+  }
+}
+
+Task receiveCounted(aisdi::Channel<CopyCounted>& channel, std::size_t& received)
+{
+  while (auto item = co_await channel.receive())
+    ++received;
+}
+
+struct StackExtent
+{
+  std::uintptr_t lowest = UINTPTR_MAX;
+  std::uintptr_t highest = 0;
+
+  void record()
+  {
+    char marker;
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(&marker);
+    lowest = std::min(lowest, address);
+    highest = std::max(highest, address);
+  }
+};
+
+Task forwardAll(aisdi::Channel<int>& from, aisdi::Channel<int>& to, StackExtent& stack)
+{
+  while (auto item = co_await from.receive())
+  {
+    stack.record();
+    co_await to.send(*item + 1);
+  }
+}
+
+} // namespace
+
+using std::begin;
+using std::end;
+
+BOOST_AUTO_TEST_SUITE(ChannelTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenUnboundedChannel_WhenSendingWithoutReceiver_ThenSenderDoesNotWait)
+{
+  aisdi::Channel<int> channel;
+  int sent = 0;
+
+  sendAll(channel, 0, 100, sent);
+
+  BOOST_CHECK_EQUAL(sent, 100);
+  BOOST_CHECK_EQUAL(channel.getSize(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(GivenWaitingReceiver_WhenSending_ThenItemIsHandedOverInOrder)
+{
+  aisdi::Channel<int> channel;
+  aisdi::Vector<int> received;
+  int sent = 0;
+
+  receiveAll(channel, received);
+  BOOST_CHECK(received.isEmpty());
+
+  sendAll(channel, 1, 4, sent);
+
+  const int expected[] = { 1, 2, 3 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(received), end(received), begin(expected), end(expected));
+  BOOST_CHECK_EQUAL(channel.getSize(), 0);
+  channel.close();
+}
+
+BOOST_AUTO_TEST_CASE(GivenWaitingReceivers_WhenSendingTemporaries_ThenItemsAreNeverCopied)
+{
+  aisdi::Channel<CopyCounted> channel;
+  aisdi::Channel<CopyCounted> batchChannel;
+  std::size_t received = 0;
+  std::size_t receivedInBatches = 0;
+  CopyCounted::copies = 0;
+
+  receiveCounted(channel, received);
+  sendTemporaries(channel, 3);
+  channel.close();
+  receiveCountedBatches(batchChannel, receivedInBatches);
+  sendTemporaries(batchChannel, 3);
+  batchChannel.close();
+
+  BOOST_CHECK_EQUAL(received, 3);
+  BOOST_CHECK_EQUAL(receivedInBatches, 3);
+  BOOST_CHECK_EQUAL(CopyCounted::copies, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBoundedChannel_WhenBufferIsFull_ThenSenderWaitsForReceiver)
+{
+  aisdi::Channel<int> channel(2);
+  aisdi::Vector<int> received;
+  int sent = 0;
+
+  sendAll(channel, 0, 5, sent);
+  BOOST_CHECK_EQUAL(sent, 2);
+  BOOST_CHECK_EQUAL(channel.getSize(), 2);
+
+  receiveAll(channel, received);
+
+  BOOST_CHECK_EQUAL(sent, 5);
+  BOOST_CHECK_EQUAL(received.getSize(), 5);
+  channel.close();
+}
+
+BOOST_AUTO_TEST_CASE(GivenChannelWithItems_WhenClosed_ThenReceiverDrainsItAndStops)
+{
+  aisdi::Channel<int> channel;
+  aisdi::Vector<int> received;
+  int sent = 0;
+  sendAll(channel, 0, 3, sent);
+  channel.close();
+
+  receiveAll(channel, received);
+
+  BOOST_CHECK(channel.isClosed());
+  BOOST_CHECK_EQUAL(received.getSize(), 3);
+  BOOST_CHECK_EQUAL(channel.getSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenClosedChannel_WhenSending_ThenOperationThrows)
+{
+  aisdi::Channel<int> channel;
+  int sent = 0;
+  bool failed = false;
+  channel.close();
+
+  sendUntilClosed(channel, sent, failed);
+
+  BOOST_CHECK(failed);
+  BOOST_CHECK_EQUAL(sent, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenWaitingSender_WhenClosing_ThenSenderFails)
+{
+  aisdi::Channel<int> channel(1);
+  int sent = 0;
+  bool failed = false;
+  sendUntilClosed(channel, sent, failed);
+  BOOST_CHECK_EQUAL(sent, 1);
+  BOOST_CHECK(!failed);
+
+  channel.close();
+
+  BOOST_CHECK(failed);
+  BOOST_CHECK_EQUAL(channel.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBufferedItems_WhenReceivingBatch_ThenUpToMaxCountItemsAreTaken)
+{
+  aisdi::Channel<int> channel;
+  aisdi::Vector<std::size_t> batchSizes;
+  int sent = 0;
+  sendAll(channel, 0, 10, sent);
+
+  receiveBatches(channel, 4, batchSizes);
+  channel.close();
+
+  const std::size_t expected[] = { 4, 4, 2 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(batchSizes), end(batchSizes), begin(expected), end(expected));
+}
+
+BOOST_AUTO_TEST_CASE(GivenLongPipelineOfWaitingReceivers_WhenSending_ThenHandOffsDoNotNest)
+{
+  const int stageCount = 10000;
+  std::vector<std::unique_ptr<aisdi::Channel<int>>> channels;
+  for (int i = 0; i <= stageCount; ++i)
+    channels.push_back(std::make_unique<aisdi::Channel<int>>());
+  StackExtent stack;
+  for (int i = 0; i < stageCount; ++i)
+    forwardAll(*channels[i], *channels[i + 1], stack);
+
+  int sent = 0;
+  sendAll(*channels[0], 0, 1, sent);
+
+  BOOST_CHECK_EQUAL(channels[stageCount]->getSize(), 1);
+  // a nested resume per stage would take megabytes
+  BOOST_CHECK_LT(stack.highest - stack.lowest, 4096u);
+  for (auto& channel : channels)
+    channel->close();
+}
+
+BOOST_AUTO_TEST_CASE(GivenProducerThread_WhenReceivingOnAnotherThread_ThenEveryItemArrives)
+{
+  aisdi::Channel<int> channel(8);
+  aisdi::Vector<int> received;
+  int sent = 0;
+
+  receiveAll(channel, received);
+  std::thread producer([&channel, &sent]() {
+    sendAll(channel, 0, 10000, sent);
+    channel.close();
+  });
+  producer.join();
+
+  BOOST_CHECK_EQUAL(sent, 10000);
+  BOOST_CHECK_EQUAL(received.getSize(), 10000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
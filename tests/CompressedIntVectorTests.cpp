@@ -0,0 +1,136 @@
+#include <CompressedIntVector.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+template <typename Collection, typename T>
+void thenCollectionMatches(const Collection& collection, const std::vector<T>& expected)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    BOOST_REQUIRE_EQUAL(collection[i], expected[i]);
+
+  std::vector<T> decoded;
+  collection.forEach([&decoded](T value) { decoded.push_back(value); });
+  BOOST_CHECK_EQUAL_COLLECTIONS(decoded.begin(), decoded.end(), expected.begin(), expected.end());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(CompressedIntVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const aisdi::CompressedIntVector<std::uint64_t> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getBlockCount(), 0);
+  BOOST_CHECK_THROW(collection[0], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSortedIds_WhenAppended_ThenTheyAreStoredInFewBits)
+{
+  aisdi::CompressedIntVector<std::uint64_t> collection;
+  std::vector<std::uint64_t> expected;
+  for (std::uint64_t i = 0; i < 128 * 100; ++i)
+  {
+    collection.append(1000000000000ULL + i * 3);
+    expected.push_back(1000000000000ULL + i * 3);
+  }
+
+  thenCollectionMatches(collection, expected);
+  BOOST_CHECK_EQUAL(collection.getBlockCount(), 100);
+  // 9 bits per value instead of 64
+  BOOST_CHECK_LT(collection.getCompressedBytes(), expected.size() * sizeof(std::uint64_t) / 5);
+}
+
+BOOST_AUTO_TEST_CASE(GivenTimestampsWithSmallGaps_WhenAppended_ThenDeltasAreStored)
+{
+  aisdi::CompressedIntVector<std::int64_t, 64> collection;
+  std::vector<std::int64_t> expected;
+  std::int64_t timestamp = 1700000000000LL;
+  for (std::size_t i = 0; i < 64 * 50; ++i)
+  {
+    timestamp += 1 + static_cast<std::int64_t>(i * 7 % 5);
+    collection.append(timestamp);
+    expected.push_back(timestamp);
+  }
+  // a block falling back to frame of reference in the middle
+  for (std::size_t i = 0; i < 64; ++i)
+  {
+    collection.append(static_cast<std::int64_t>(i * 37 % 64));
+    expected.push_back(static_cast<std::int64_t>(i * 37 % 64));
+  }
+
+  thenCollectionMatches(collection, expected);
+  // gaps of 1-5 take 3 bits plus the block headers; frame of reference
+  // would need 9 bits and not fit
+  BOOST_CHECK_LT(collection.getCompressedBytes(), expected.size() * sizeof(std::int64_t) / 8);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPartialBlock_WhenReading_ThenPendingValuesAreReturned)
+{
+  aisdi::CompressedIntVector<std::uint32_t, 8> collection = { 5, 6, 7, 8, 9, 10, 11, 12, 13, 14 };
+
+  BOOST_CHECK_EQUAL(collection.getBlockCount(), 2);
+  thenCollectionMatches(collection, std::vector<std::uint32_t>{ 5, 6, 7, 8, 9, 10, 11, 12, 13, 14 });
+
+  std::uint32_t decoded[8];
+  BOOST_CHECK_EQUAL(collection.decodeBlock(1, decoded), 2);
+  BOOST_CHECK_EQUAL(decoded[1], 14u);
+  BOOST_CHECK_THROW(collection.decodeBlock(2, decoded), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenConstantBlock_WhenDecoding_ThenZeroWidthIsHandled)
+{
+  aisdi::CompressedIntVector<std::int16_t, 4> collection = { 7, 7, 7, 7, 7 };
+
+  BOOST_CHECK_EQUAL(collection.getBlockCount(), 2);
+  thenCollectionMatches(collection, std::vector<std::int16_t>{ 7, 7, 7, 7, 7 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenSignedValuesOverWholeRange_WhenAppended_ThenTheyRoundTrip)
+{
+  aisdi::CompressedIntVector<std::int64_t, 16> collection;
+  std::vector<std::int64_t> expected;
+  std::uint64_t seed = 99;
+  for (int i = 0; i < 1000; ++i)
+  {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    // mix blocks of small and full-range values
+    std::int64_t value = (i / 16) % 2 ? static_cast<std::int64_t>(seed) : static_cast<std::int64_t>(seed % 50) - 25;
+    collection.append(value);
+    expected.push_back(value);
+  }
+  collection.append(std::numeric_limits<std::int64_t>::min());
+  expected.push_back(std::numeric_limits<std::int64_t>::min());
+
+  thenCollectionMatches(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenCopiedAndMoved_ThenValuesAreKept)
+{
+  aisdi::CompressedIntVector<std::uint16_t, 4> collection = { 1, 2, 3, 4, 5, 6 };
+
+  aisdi::CompressedIntVector<std::uint16_t, 4> copy(collection);
+  collection.append(7);
+  aisdi::CompressedIntVector<std::uint16_t, 4> moved(std::move(collection));
+
+  BOOST_CHECK(collection.isEmpty());
+  thenCollectionMatches(copy, std::vector<std::uint16_t>{ 1, 2, 3, 4, 5, 6 });
+  thenCollectionMatches(moved, std::vector<std::uint16_t>{ 1, 2, 3, 4, 5, 6, 7 });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,221 @@
+#include <ConcurrentQueue.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+// copying (or assigning) throws once the budget of copies (or assignments)
+// is spent; alive counts the constructed instances
+struct ThrowingCopy
+{
+  static int alive;
+  static int copiesLeft;
+  static int assignmentsLeft;
+
+  int value;
+
+  ThrowingCopy(int value = 0) : value(value)
+  {
+    ++alive;
+  }
+
+  ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+  {
+    if (copiesLeft-- == 0)
+      throw std::runtime_error("copy failed");
+    ++alive;
+  }
+
+  ThrowingCopy& operator=(const ThrowingCopy& other)
+  {
+    if (assignmentsLeft-- == 0)
+      throw std::runtime_error("assignment failed");
+    value = other.value;
+    return *this;
+  }
+
+  ~ThrowingCopy()
+  {
+    --alive;
+  }
+};
+
+int ThrowingCopy::alive = 0;
+int ThrowingCopy::copiesLeft = -1;
+int ThrowingCopy::assignmentsLeft = -1;
+
+} // namespace
+
+template <typename T>
+using ConcurrentCollection = aisdi::ConcurrentQueue<T>;
+
+BOOST_AUTO_TEST_SUITE(ConcurrentQueueTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  ConcurrentCollection<int> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPoppingFirst_ThenOperationFails)
+{
+  ConcurrentCollection<int> collection;
+  int item = 7;
+
+  BOOST_CHECK(!collection.tryPopFirst(item));
+  BOOST_CHECK_EQUAL(item, 7);
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenAppendingItem_ThenItIsNoLongerEmpty)
+{
+  ConcurrentCollection<int> collection;
+
+  collection.append(42);
+
+  BOOST_CHECK(!collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPoppingFirst_ThenItemsAreReturnedInFifoOrder)
+{
+  ConcurrentCollection<std::string> collection;
+  collection.append("Lorem");
+  collection.append("ipsum");
+  collection.append("dolor");
+
+  std::string item;
+  BOOST_CHECK(collection.tryPopFirst(item));
+  BOOST_CHECK_EQUAL(item, "Lorem");
+  BOOST_CHECK_EQUAL(collection.popFirst(), "ipsum");
+  BOOST_CHECK_EQUAL(collection.popFirst(), "dolor");
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenDestroyed_ThenRemainingItemsAreReleased)
+{
+  std::shared_ptr<int> counted = std::make_shared<int>(0);
+  {
+    ConcurrentCollection<std::shared_ptr<int>> collection;
+    for (int i = 0; i < 1000; ++i)
+      collection.append(counted);
+    for (int i = 0; i < 500; ++i)
+      collection.popFirst();
+  }
+
+  BOOST_CHECK_EQUAL(counted.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingCopies_WhenAppendingAndPopping_ThenNothingLeaks)
+{
+  {
+    ConcurrentCollection<ThrowingCopy> collection;
+    const ThrowingCopy first(1);
+    const ThrowingCopy second(2);
+
+    ThrowingCopy::copiesLeft = 0;
+    BOOST_CHECK_THROW(collection.append(first), std::runtime_error);
+    ThrowingCopy::copiesLeft = -1;
+    BOOST_CHECK(collection.isEmpty());
+
+    collection.append(first);
+    collection.append(second);
+    ThrowingCopy item;
+    ThrowingCopy::assignmentsLeft = 0;
+    BOOST_CHECK_THROW(collection.tryPopFirst(item), std::runtime_error);
+    ThrowingCopy::assignmentsLeft = -1;
+
+    BOOST_CHECK_EQUAL(ThrowingCopy::alive, 4);
+    BOOST_CHECK(collection.tryPopFirst(item));
+    BOOST_CHECK_EQUAL(item.value, 2);
+    BOOST_CHECK(collection.isEmpty());
+  }
+  BOOST_CHECK_EQUAL(ThrowingCopy::alive, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyProducersAndConsumers_WhenRunningConcurrently_ThenEveryItemIsPoppedOnce)
+{
+  const std::size_t threadCount = 4;
+  const std::uint64_t itemsPerProducer = 20000;
+  ConcurrentCollection<std::uint64_t> collection;
+  std::atomic<std::uint64_t> poppedCount(0);
+  std::atomic<std::uint64_t> poppedSum(0);
+  std::vector<std::thread> threads;
+
+  for (std::size_t t = 0; t < threadCount; ++t)
+  {
+    threads.emplace_back([&collection, t, itemsPerProducer]() {
+      for (std::uint64_t i = 0; i < itemsPerProducer; ++i)
+        collection.append(t * itemsPerProducer + i + 1);
+    });
+
+    threads.emplace_back([&collection, &poppedCount, &poppedSum, threadCount, itemsPerProducer]() {
+      std::uint64_t item;
+      while (poppedCount.load() < threadCount * itemsPerProducer)
+      {
+        if (collection.tryPopFirst(item))
+        {
+          poppedSum += item;
+          ++poppedCount;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  const std::uint64_t total = threadCount * itemsPerProducer;
+  BOOST_CHECK_EQUAL(poppedCount.load(), total);
+  BOOST_CHECK_EQUAL(poppedSum.load(), total * (total + 1) / 2);
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenSingleProducer_WhenConsumingConcurrently_ThenOrderIsPreserved)
+{
+  const int itemCount = 50000;
+  ConcurrentCollection<int> collection;
+  bool ordered = true;
+
+  std::thread consumer([&collection, &ordered, itemCount]() {
+    int expected = 0;
+    int item;
+    while (expected < itemCount)
+    {
+      if (collection.tryPopFirst(item))
+      {
+        ordered = ordered && item == expected;
+        ++expected;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  for (int i = 0; i < itemCount; ++i)
+    collection.append(i);
+  consumer.join();
+
+  BOOST_CHECK(ordered);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
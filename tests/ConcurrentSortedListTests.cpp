@@ -0,0 +1,122 @@
+#include <ConcurrentSortedList.h>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+template <typename T>
+using ConcurrentCollection = aisdi::ConcurrentSortedList<T>;
+
+BOOST_AUTO_TEST_SUITE(ConcurrentSortedListTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  ConcurrentCollection<int> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(!collection.contains(0));
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenInsertingItems_ThenTheyAreContained)
+{
+  ConcurrentCollection<std::string> collection;
+
+  BOOST_CHECK(collection.insert("dolor"));
+  BOOST_CHECK(collection.insert("Lorem"));
+  BOOST_CHECK(collection.insert("ipsum"));
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 3);
+  BOOST_CHECK(collection.contains("Lorem"));
+  BOOST_CHECK(collection.contains("ipsum"));
+  BOOST_CHECK(collection.contains("dolor"));
+  BOOST_CHECK(!collection.contains("sit"));
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenInsertingDuplicate_ThenOperationFails)
+{
+  ConcurrentCollection<int> collection;
+  collection.insert(42);
+
+  BOOST_CHECK(!collection.insert(42));
+  BOOST_CHECK_EQUAL(collection.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenErasingItems_ThenTheyAreNoLongerContained)
+{
+  ConcurrentCollection<int> collection;
+  for (int i = 0; i < 10; ++i)
+    collection.insert(i);
+
+  BOOST_CHECK(collection.erase(0));
+  BOOST_CHECK(collection.erase(5));
+  BOOST_CHECK(collection.erase(9));
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 7);
+  BOOST_CHECK(!collection.contains(0));
+  BOOST_CHECK(!collection.contains(5));
+  BOOST_CHECK(!collection.contains(9));
+  BOOST_CHECK(collection.contains(4));
+  BOOST_CHECK(collection.contains(6));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenErasingMissingItem_ThenOperationFails)
+{
+  ConcurrentCollection<int> collection;
+  collection.insert(1);
+
+  BOOST_CHECK(!collection.erase(2));
+  BOOST_CHECK(collection.erase(1));
+  BOOST_CHECK(!collection.erase(1));
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyWritersAndReaders_WhenRunningConcurrently_ThenFinalContentsAreConsistent)
+{
+  const int threadCount = 4;
+  const int itemsPerThread = 2000;
+  ConcurrentCollection<int> collection;
+  std::atomic<bool> writersDone(false);
+  std::atomic<bool> readersSawStableItem(true);
+  std::vector<std::thread> writers;
+  collection.insert(-1);
+
+  for (int t = 0; t < threadCount; ++t)
+  {
+    writers.emplace_back([&collection, t]() {
+      for (int i = t; i < threadCount * itemsPerThread; i += threadCount)
+        collection.insert(i);
+      for (int i = t; i < threadCount * itemsPerThread; i += threadCount)
+        if (i % 2)
+          collection.erase(i);
+    });
+  }
+
+  std::thread reader([&collection, &writersDone, &readersSawStableItem]() {
+    while (!writersDone.load())
+    {
+      if (!collection.contains(-1))
+        readersSawStableItem = false;
+      collection.contains(threadCount * itemsPerThread / 2);
+      std::this_thread::yield();
+    }
+  });
+
+  for (auto& writer : writers)
+    writer.join();
+  writersDone = true;
+  reader.join();
+
+  BOOST_CHECK(readersSawStableItem.load());
+  BOOST_CHECK_EQUAL(collection.getSize(), threadCount * itemsPerThread / 2 + 1);
+  for (int i = 0; i < threadCount * itemsPerThread; ++i)
+    BOOST_CHECK_EQUAL(collection.contains(i), i % 2 == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
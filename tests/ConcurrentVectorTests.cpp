@@ -0,0 +1,200 @@
+#include <ConcurrentVector.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+// throws when copied while armed
+struct ThrowingCopy
+{
+  static int alive;
+  static bool armed;
+
+  int value;
+
+  ThrowingCopy(int value) : value(value)
+  {
+    ++alive;
+  }
+
+  ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+  {
+    if (armed)
+      throw std::runtime_error("copy failed");
+    ++alive;
+  }
+
+  ~ThrowingCopy()
+  {
+    --alive;
+  }
+};
+
+int ThrowingCopy::alive = 0;
+bool ThrowingCopy::armed = false;
+
+} // namespace
+
+template <typename T>
+using ConcurrentCollection = aisdi::ConcurrentVector<T>;
+
+using std::begin;
+using std::end;
+
+BOOST_AUTO_TEST_SUITE(ConcurrentVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  ConcurrentCollection<int> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getSize(), 0);
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenAppendingItems_ThenTheyAreReadableByIndex)
+{
+  ConcurrentCollection<std::string> collection;
+
+  BOOST_CHECK_EQUAL(collection.append("Lorem"), 0);
+  BOOST_CHECK_EQUAL(collection.append("ipsum"), 1);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 2);
+  BOOST_CHECK_EQUAL(collection[0], "Lorem");
+  BOOST_CHECK_EQUAL(collection[1], "ipsum");
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenIndexingPastTheEnd_ThenExceptionIsThrown)
+{
+  ConcurrentCollection<int> collection;
+  collection.append(1);
+
+  BOOST_CHECK_THROW(collection[1], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenGrowingOverManySegments_ThenItemsDoNotMove)
+{
+  ConcurrentCollection<int> collection;
+  collection.append(0);
+  const int *first = &collection[0];
+  collection.append(1);
+  const int *second = &collection[1];
+
+  for (int i = 2; i < 10000; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_EQUAL(first, &collection[0]);
+  BOOST_CHECK_EQUAL(second, &collection[1]);
+  for (int i = 0; i < 10000; ++i)
+    BOOST_CHECK_EQUAL(collection[i], i);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenIterating_ThenItemsAreVisitedInOrder)
+{
+  ConcurrentCollection<int> collection;
+  for (int i = 0; i < 5; ++i)
+    collection.append(i * i);
+
+  const int expected[] = { 0, 1, 4, 9, 16 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), begin(expected), end(expected));
+
+  auto it = collection.end();
+  BOOST_CHECK_EQUAL(*(--it), 16);
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIterator_WhenItemsAreAppendedLater_ThenItStillEndsAtItsSnapshot)
+{
+  ConcurrentCollection<int> collection;
+  collection.append(1);
+  auto it = collection.begin();
+
+  collection.append(2);
+
+  BOOST_CHECK_EQUAL(*it, 1);
+  ++it;
+  BOOST_CHECK_THROW(*it, std::out_of_range);
+  BOOST_CHECK_THROW(++it, std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingCopy_WhenAppending_ThenFailedSlotIsSkippedAndLaterItemsArePublished)
+{
+  {
+    ConcurrentCollection<ThrowingCopy> collection;
+    collection.append(ThrowingCopy(1));
+    ThrowingCopy::armed = true;
+    BOOST_CHECK_THROW(collection.append(ThrowingCopy(2)), std::runtime_error);
+    ThrowingCopy::armed = false;
+    collection.append(ThrowingCopy(3));
+
+    BOOST_CHECK_EQUAL(collection.getSize(), 3);
+    BOOST_CHECK_EQUAL(collection[2].value, 3);
+    BOOST_CHECK_THROW(collection[1], std::out_of_range);
+
+    std::vector<int> values;
+    for (auto it = collection.begin(); it != collection.end(); ++it)
+      values.push_back(it->value);
+    const int expected[] = { 1, 3 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(), begin(expected), end(expected));
+
+    auto it = collection.end();
+    --it;
+    BOOST_CHECK_EQUAL((--it)->value, 1);
+  }
+
+  BOOST_CHECK_EQUAL(ThrowingCopy::alive, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyWriters_WhenAppendingConcurrently_ThenEveryItemIsPublishedOnce)
+{
+  const std::size_t writerCount = 4;
+  const std::size_t itemsPerWriter = 20000;
+  ConcurrentCollection<std::size_t> collection;
+
+  std::vector<std::thread> writers;
+  for (std::size_t w = 0; w < writerCount; ++w)
+    writers.emplace_back([&collection, w, itemsPerWriter]() {
+      for (std::size_t i = 0; i < itemsPerWriter; ++i)
+        collection.append(w * itemsPerWriter + i);
+    });
+
+  // the published prefix only ever contains constructed items
+  std::atomic<bool> corrupted(false);
+  std::thread reader([&collection, &corrupted, writerCount, itemsPerWriter]() {
+    while (collection.getSize() < writerCount * itemsPerWriter)
+    {
+      std::size_t size = collection.getSize();
+      if (size > 0 && collection[size - 1] >= writerCount * itemsPerWriter)
+        corrupted = true;
+      std::this_thread::yield();
+    }
+  });
+
+  for (auto &writer : writers)
+    writer.join();
+  reader.join();
+
+  BOOST_CHECK(!corrupted);
+
+  std::vector<bool> seen(writerCount * itemsPerWriter, false);
+  for (auto item : collection)
+  {
+    BOOST_REQUIRE(item < seen.size());
+    BOOST_CHECK(!seen[item]);
+    seen[item] = true;
+  }
+  BOOST_CHECK_EQUAL(collection.getSize(), writerCount * itemsPerWriter);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,112 @@
+#include <FlatCombined.h>
+#include <LinkedList.h>
+#include <Vector.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+using TestedContainers = boost::mpl::list<aisdi::LinkedList<std::uint64_t>,
+                                          aisdi::Vector<std::uint64_t>>;
+
+using std::begin;
+using std::end;
+
+BOOST_AUTO_TEST_SUITE(FlatCombinedTests)
+
+template <typename C>
+void thenCollectionContainsValues(aisdi::FlatCombined<C>& collection,
+                                  std::initializer_list<int> expected)
+{
+  collection.apply([&expected](C& c) {
+    BOOST_CHECK_EQUAL_COLLECTIONS(begin(c), end(c), begin(expected), end(expected));
+  });
+}
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty,
+                              C,
+                              TestedContainers)
+{
+  aisdi::FlatCombined<C> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenApplyingSequentialOperations_ThenTheyAreForwarded,
+                              C,
+                              TestedContainers)
+{
+  aisdi::FlatCombined<C> collection;
+
+  collection.append(2);
+  collection.append(4);
+  collection.prepend(1);
+  collection.insert(2, 3);
+
+  thenCollectionContainsValues(collection, { 1, 2, 3, 4 });
+  BOOST_CHECK_EQUAL(collection.popFirst(), 1);
+  BOOST_CHECK_EQUAL(collection.popLast(), 4);
+  collection.erase(0);
+  thenCollectionContainsValues(collection, { 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPoppingFirst_ThenExceptionIsRethrownToCaller,
+                              C,
+                              TestedContainers)
+{
+  aisdi::FlatCombined<C> collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(0), std::out_of_range);
+
+  collection.append(1);
+  BOOST_CHECK_EQUAL(collection.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenManyThreads_WhenAppendingConcurrently_ThenNoItemIsLost,
+                              C,
+                              TestedContainers)
+{
+  const std::size_t threadCount = 4;
+  const std::uint64_t itemsPerThread = 5000;
+  aisdi::FlatCombined<C> collection;
+  std::vector<std::thread> threads;
+
+  for (std::size_t t = 0; t < threadCount; ++t)
+  {
+    threads.emplace_back([&collection, t, itemsPerThread]() {
+      for (std::uint64_t i = 0; i < itemsPerThread; ++i)
+      {
+        collection.append(t * itemsPerThread + i + 1);
+        if (i % 4 == 3)
+          collection.insert(0, 0);
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  const std::uint64_t total = threadCount * itemsPerThread;
+  BOOST_CHECK_EQUAL(collection.getSize(), total + total / 4);
+
+  std::uint64_t sum = 0;
+  collection.apply([&sum](C& c) {
+    for (auto it = c.cbegin(); it != c.cend(); ++it)
+      sum += *it;
+  });
+  BOOST_CHECK_EQUAL(sum, total * (total + 1) / 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+#include <FlatMap.h>
+
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+using Map = aisdi::FlatMap<int, std::string>;
+
+void thenMapContains(const Map& map, const std::map<int, std::string>& expected)
+{
+  BOOST_REQUIRE_EQUAL(map.getSize(), expected.size());
+  auto it = map.begin();
+  for (const auto& item : expected)
+  {
+    BOOST_CHECK_EQUAL((*it).first, item.first);
+    BOOST_CHECK_EQUAL((*it).second, item.second);
+    ++it;
+  }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(FlatMapTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const Map map;
+
+  BOOST_CHECK(map.isEmpty());
+  BOOST_CHECK(!map.contains(1));
+  BOOST_CHECK_THROW(map.at(1), std::out_of_range);
+  BOOST_CHECK(map.find(1) == map.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenInsertingExistingKey_ThenValueIsKept)
+{
+  Map map;
+
+  BOOST_CHECK(map.insert(2, "dolor"));
+  BOOST_CHECK(map.insert(1, "Lorem"));
+  BOOST_CHECK(!map.insert(2, "ipsum"));
+
+  thenMapContains(map, { { 1, "Lorem" }, { 2, "dolor" } });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenInsertingOrAssigning_ThenValueIsReplaced)
+{
+  Map map = { { 1, "Lorem" } };
+
+  map.insertOrAssign(1, "ipsum");
+  map.insertOrAssign(0, "dolor");
+
+  thenMapContains(map, { { 0, "dolor" }, { 1, "ipsum" } });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenUsingSubscript_ThenMissingKeyIsInsertedWithDefaultValue)
+{
+  Map map = { { 1, "Lorem" }, { 5, "ipsum" } };
+
+  BOOST_CHECK_EQUAL(map[5], "ipsum");
+  BOOST_CHECK_EQUAL(map[3], "");
+  map[3] = "dolor";
+  map.at(1) = "sit";
+
+  thenMapContains(map, { { 1, "sit" }, { 3, "dolor" }, { 5, "ipsum" } });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenInsertingBatch_ThenFirstValueOfEveryKeyWins)
+{
+  Map map = { { 10, "ten" }, { 30, "thirty" } };
+  const std::vector<std::pair<int, std::string>> batch = {
+    { 20, "twenty" }, { 10, "TEN" }, { 40, "forty" }, { 20, "TWENTY" }, { 0, "zero" }
+  };
+
+  BOOST_CHECK_EQUAL(map.insertBatch(batch.begin(), batch.end()), 3);
+
+  thenMapContains(map, { { 0, "zero" }, { 10, "ten" }, { 20, "twenty" }, { 30, "thirty" }, { 40, "forty" } });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenQueryingRange_ThenItemsInHalfOpenRangeAreReturned)
+{
+  const Map map = { { 1, "a" }, { 4, "b" }, { 6, "c" }, { 9, "d" } };
+
+  auto range = map.range(2, 9);
+
+  BOOST_REQUIRE(range.first != range.second);
+  BOOST_CHECK_EQUAL((*range.first).second, "b");
+  BOOST_CHECK_EQUAL((*(range.first + 1)).second, "c");
+  BOOST_CHECK(range.first + 2 == range.second);
+  BOOST_CHECK_EQUAL((*map.lowerBound(6)).second, "c");
+  BOOST_CHECK_EQUAL((*map.upperBound(6)).second, "d");
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenErasingKeys_ThenOnlyPresentOnesAreRemoved)
+{
+  Map map = { { 1, "Lorem" }, { 2, "ipsum" } };
+
+  BOOST_CHECK(map.erase(1));
+  BOOST_CHECK(!map.erase(3));
+
+  thenMapContains(map, { { 2, "ipsum" } });
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyBatchesAndUpdates_WhenComparedWithStdMap_ThenTheyMatch)
+{
+  Map map;
+  std::map<int, std::string> reference;
+  for (int round = 0; round < 10; ++round)
+  {
+    std::vector<std::pair<int, std::string>> batch;
+    for (int i = 0; i < 300; ++i)
+    {
+      int key = (round * 31 + i * 7919) % 2000;
+      batch.emplace_back(key, std::to_string(round));
+    }
+
+    map.insertBatch(batch.begin(), batch.end());
+    reference.insert(batch.begin(), batch.end());
+    map[round * 3] += "!";
+    reference[round * 3] += "!";
+    map.erase(round * 17);
+    reference.erase(round * 17);
+  }
+
+  thenMapContains(map, reference);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
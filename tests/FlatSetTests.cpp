@@ -0,0 +1,139 @@
+#include <FlatSet.h>
+
+#include <cstddef>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+template <typename Key, typename Compare>
+void thenSetContains(const aisdi::FlatSet<Key, Compare>& set, const std::vector<Key>& expected)
+{
+  std::vector<Key> keys(set.begin(), set.end());
+  BOOST_CHECK_EQUAL(set.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(keys.begin(), keys.end(), expected.begin(), expected.end());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(FlatSetTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const aisdi::FlatSet<int> set;
+
+  BOOST_CHECK(set.isEmpty());
+  BOOST_CHECK(!set.contains(0));
+  BOOST_CHECK(set.find(0) == set.end());
+  BOOST_CHECK(set.begin() == set.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenInsertingKeys_ThenTheyAreKeptSortedAndUnique)
+{
+  aisdi::FlatSet<int> set;
+
+  BOOST_CHECK(set.insert(5));
+  BOOST_CHECK(set.insert(1));
+  BOOST_CHECK(set.insert(3));
+  BOOST_CHECK(!set.insert(3));
+
+  thenSetContains(set, std::vector<int>{ 1, 3, 5 });
+  BOOST_CHECK(set.contains(3));
+  BOOST_CHECK_EQUAL(*set.find(5), 5);
+  BOOST_CHECK(set.find(4) == set.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenErasingKeys_ThenOnlyPresentOnesAreRemoved)
+{
+  aisdi::FlatSet<std::string> set = { "Lorem", "ipsum", "dolor" };
+
+  BOOST_CHECK(set.erase("ipsum"));
+  BOOST_CHECK(!set.erase("sit"));
+
+  thenSetContains(set, std::vector<std::string>{ "Lorem", "dolor" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenInsertingBatch_ThenItIsMergedWithoutDuplicates)
+{
+  aisdi::FlatSet<int> set = { 10, 20, 30 };
+  const std::vector<int> batch = { 25, 5, 20, 35, 5, 15 };
+
+  BOOST_CHECK_EQUAL(set.insertBatch(batch.begin(), batch.end()), 4);
+
+  thenSetContains(set, std::vector<int>{ 5, 10, 15, 20, 25, 30, 35 });
+  BOOST_CHECK_EQUAL(set.insertBatch(batch.begin(), batch.begin()), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyBatches_WhenInserted_ThenSetMatchesStdSet)
+{
+  aisdi::FlatSet<int> set;
+  std::set<int> reference;
+  for (int round = 0; round < 20; ++round)
+  {
+    std::vector<int> batch;
+    for (int i = 0; i < 200; ++i)
+      batch.push_back((round * 7919 + i * 104729) % 5000);
+
+    std::size_t sizeBefore = reference.size();
+    reference.insert(batch.begin(), batch.end());
+    BOOST_CHECK_EQUAL(set.insertBatch(batch.begin(), batch.end()), reference.size() - sizeBefore);
+    set.insert(round * 1000 + 1);
+    reference.insert(round * 1000 + 1);
+    set.erase(round * 13);
+    reference.erase(round * 13);
+  }
+
+  thenSetContains(set, std::vector<int>(reference.begin(), reference.end()));
+  for (int key = -1; key <= 5001; ++key)
+  {
+    BOOST_REQUIRE_EQUAL(set.contains(key), reference.count(key) == 1);
+    BOOST_REQUIRE_EQUAL(set.lowerBound(key) == set.end(), reference.lower_bound(key) == reference.end());
+    if (set.upperBound(key) != set.end())
+      BOOST_REQUIRE_EQUAL(*set.upperBound(key), *reference.upper_bound(key));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenQueryingRange_ThenKeysInHalfOpenRangeAreReturned)
+{
+  const aisdi::FlatSet<int> set = { 1, 3, 5, 7, 9 };
+
+  auto range = set.range(3, 8);
+  std::vector<int> keys(range.first, range.second);
+  std::vector<int> expected = { 3, 5, 7 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(keys.begin(), keys.end(), expected.begin(), expected.end());
+
+  auto empty = set.range(8, 3);
+  BOOST_CHECK(empty.first == empty.second);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCustomCompare_WhenInsertingBatch_ThenItsOrderIsUsed)
+{
+  aisdi::FlatSet<int, std::greater<int>> set = { 1, 2 };
+  const std::vector<int> batch = { 3, 0, 2 };
+
+  set.insertBatch(batch.begin(), batch.end());
+
+  thenSetContains(set, std::vector<int>{ 3, 2, 1, 0 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenSet_WhenCopied_ThenCopyIsIndependent)
+{
+  aisdi::FlatSet<int> set = { 1, 2 };
+  aisdi::FlatSet<int> other(set);
+
+  other.insert(3);
+  set.erase(1);
+
+  thenSetContains(set, std::vector<int>{ 2 });
+  thenSetContains(other, std::vector<int>{ 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,423 @@
+#include <ForwardList.h>
+
+#include <initializer_list>
+#include <complex>
+#include <cstdint>
+#include <cstddef>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace
+{
+
+class OperationCountingObject
+{
+public:
+  OperationCountingObject(int value_ = 0)
+    : value(value_)
+  {
+    ++constructedObjects;
+  }
+
+  OperationCountingObject(const OperationCountingObject& other)
+    : value(std::move(other.value))
+  {
+    ++constructedObjects;
+    ++copiedObjects;
+  }
+
+  OperationCountingObject(OperationCountingObject&& other)
+    : value(other.value)
+  {
+    ++constructedObjects;
+    ++movedObjects;
+  }
+
+  ~OperationCountingObject()
+  {
+    ++destroyedObjects;
+  }
+
+  OperationCountingObject& operator=(const OperationCountingObject& other)
+  {
+    ++assignedObjects;
+    value = other.value;
+    return *this;
+  }
+
+  OperationCountingObject& operator=(OperationCountingObject&& other)
+  {
+    ++assignedObjects;
+    ++movedObjects;
+    value = std::move(other.value);
+    return *this;
+  }
+
+  operator int() const
+  {
+    return value;
+  }
+
+  static void resetCounters()
+  {
+    constructedObjects = 0;
+    destroyedObjects = 0;
+    copiedObjects = 0;
+    movedObjects = 0;
+    assignedObjects = 0;
+  }
+
+  static std::size_t constructedObjectsCount()
+  {
+    return constructedObjects;
+  }
+
+  static std::size_t destroyedObjectsCount()
+  {
+    return destroyedObjects;
+  }
+
+  static std::size_t copiedObjectsCount()
+  {
+    return copiedObjects;
+  }
+
+  static std::size_t movedObjectsCount()
+  {
+    return movedObjects;
+  }
+
+  static std::size_t assignedObjectsCount()
+  {
+    return assignedObjects;
+  }
+
+private:
+  int value;
+
+  static std::size_t constructedObjects;
+  static std::size_t destroyedObjects;
+  static std::size_t copiedObjects;
+  static std::size_t movedObjects;
+  static std::size_t assignedObjects;
+};
+
+std::size_t OperationCountingObject::constructedObjects = 0;
+std::size_t OperationCountingObject::destroyedObjects = 0;
+std::size_t OperationCountingObject::copiedObjects = 0;
+std::size_t OperationCountingObject::movedObjects = 0;
+std::size_t OperationCountingObject::assignedObjects = 0 ;
+
+std::ostream& operator<<(std::ostream& out, const OperationCountingObject& obj)
+{
+  return out << '<' << static_cast<int>(obj) << '>';
+}
+
+struct Fixture
+{
+  Fixture()
+  {
+    OperationCountingObject::resetCounters();
+  }
+};
+
+} // namespace
+
+template <typename T>
+using LinearCollection = aisdi::ForwardList<T>;
+
+using TestedTypes = boost::mpl::list<std::int32_t,
+                                     std::uint64_t,
+                                     std::complex<std::int32_t>,
+                                     OperationCountingObject>;
+
+using std::begin;
+using std::end;
+
+BOOST_FIXTURE_TEST_SUITE(ForwardListTests, Fixture)
+
+template <typename T>
+void thenCollectionContainsValues(const LinearCollection<T>& collection,
+                                  std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection),
+                                begin(expected), end(expected));
+}
+
+template <typename T>
+void thenConstructedObjectsCountWas(std::size_t count)
+{
+  (void) count;
+  // unable to check it (in a simple way) for all objects, hence template specialization.
+}
+
+template <typename T>
+void thenDestroyedObjectsCountWas(std::size_t count)
+{
+  (void) count;
+  // unable to check it (in a simple way) for all objects, hence template specialization.
+}
+
+template <typename T>
+void thenCopiedObjectsCountWas(std::size_t count)
+{
+  (void) count;
+  // unable to check it (in a simple way) for all objects, hence template specialization.
+}
+
+template <typename T>
+void thenMovedObjectsCountWas(std::size_t count)
+{
+  (void) count;
+  // unable to check it (in a simple way) for all objects, hence template specialization.
+}
+
+template <typename T>
+void thenAssignedObjectsCountWas(std::size_t count)
+{
+  (void) count;
+  // unable to check it (in a simple way) for all objects, hence template specialization.
+}
+
+template <>
+void thenConstructedObjectsCountWas<OperationCountingObject>(std::size_t count)
+{
+  BOOST_CHECK_EQUAL(OperationCountingObject::constructedObjectsCount(), count);
+}
+
+template <>
+void thenDestroyedObjectsCountWas<OperationCountingObject>(std::size_t count)
+{
+  BOOST_CHECK_EQUAL(OperationCountingObject::destroyedObjectsCount(), count);
+}
+
+template <>
+void thenCopiedObjectsCountWas<OperationCountingObject>(std::size_t count)
+{
+  BOOST_CHECK_EQUAL(OperationCountingObject::copiedObjectsCount(), count);
+}
+
+template <>
+void thenMovedObjectsCountWas<OperationCountingObject>(std::size_t count)
+{
+  BOOST_CHECK_EQUAL(OperationCountingObject::movedObjectsCount(), count);
+}
+
+template <>
+void thenAssignedObjectsCountWas<OperationCountingObject>(std::size_t count)
+{
+  BOOST_CHECK_EQUAL(OperationCountingObject::assignedObjectsCount(), count);
+}
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenAddingItem_ThenItIsNoLongerEmpty,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  collection.append(T{});
+
+  BOOST_CHECK(!collection.isEmpty());
+  BOOST_CHECK(collection.begin() != collection.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenPostIncrementing_ThenPreviousPositionIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.append(T{});
+
+  auto it = collection.begin();
+  auto postIncrementedIt = it++;
+
+  BOOST_CHECK(postIncrementedIt == collection.begin());
+  BOOST_CHECK(it == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEndIterator_WhenIncrementing_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK_THROW(collection.end()++, std::out_of_range);
+  BOOST_CHECK_THROW(++(collection.end()), std::out_of_range);
+  BOOST_CHECK_THROW(collection.cend()++, std::out_of_range);
+  BOOST_CHECK_THROW(++(collection.cend()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEndIterator_WhenDereferencing_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(*collection.cend(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIterator_WhenDereferencing_ThenItemCanBeChanged,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 10, 20, 30 };
+
+  auto it = begin(collection) + 1;
+  *it = 500;
+
+  thenCollectionContainsValues(collection, { 10, 500, 30 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenCreatingCopy_ThenAllItemsAreCopied,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1410, 753, 1789 };
+  LinearCollection<T> other{collection};
+
+  collection.append(1024);
+
+  thenCollectionContainsValues(collection, { 1410, 753, 1789, 1024 });
+  thenCollectionContainsValues(other, { 1410, 753, 1789 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenMovingToOther_ThenAllItemsAreMoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1410, 753, 1789 };
+  LinearCollection<T> other{std::move(collection)};
+
+  thenCollectionContainsValues(other, { 1410, 753, 1789 });
+  thenConstructedObjectsCountWas<T>(6);
+  thenCopiedObjectsCountWas<T>(3);
+  thenAssignedObjectsCountWas<T>(0);
+  thenMovedObjectsCountWas<T>(0);
+  thenDestroyedObjectsCountWas<T>(3);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenAssigningToOther_ThenAllElementsAreCopied,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+  LinearCollection<T> other = { 100, 200, 300, 400 };
+
+  other = collection;
+
+  thenCollectionContainsValues(other, { 1, 2, 3 });
+  other.append(4);
+  thenCollectionContainsValues(other, { 1, 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenMoveAssigning_ThenAllElementsAreMoved,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+  LinearCollection<T> other = { 100, 200, 300, 400 };
+
+  other = std::move(collection);
+
+  thenCollectionContainsValues(other, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenAppendingItem_ThenItemIsLast,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  collection.append(42);
+
+  thenCollectionContainsValues(collection, { 1, 2, 3, 42 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPrependingItem_ThenItemIsAdded,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  collection.prepend(42);
+  collection.append(43);
+
+  thenCollectionContainsValues(collection, { 42, 43 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPrependingItem_ThenItemIsFirst,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+
+  collection.prepend(42);
+
+  thenCollectionContainsValues(collection, { 42, 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenChangingIt_ThenItsSizeAlsoChanges,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  BOOST_CHECK_EQUAL(collection.getSize(), 0);
+
+  collection.append(1);
+  collection.prepend(2);
+  BOOST_CHECK_EQUAL(collection.getSize(), 2);
+
+  collection.popFirst();
+  BOOST_CHECK_EQUAL(collection.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenPoppingFirst_ThenOperationThrows,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenPoppingFirst_ThenItemsIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 101, 202, 303 };
+
+  BOOST_CHECK_EQUAL(collection.popFirst(), 101);
+  thenCollectionContainsValues(collection, { 202, 303 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionWithSingleItem_WhenPoppingFirst_ThenItemsCanBeAppendedAgain,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 101 };
+
+  collection.popFirst();
+  BOOST_CHECK(collection.isEmpty());
+
+  collection.append(202);
+  collection.append(303);
+  thenCollectionContainsValues(collection, { 202, 303 });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,145 @@
+#include <GapBuffer.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+template <typename T>
+using LinearCollection = aisdi::GapBuffer<T>;
+
+using std::begin;
+using std::end;
+
+namespace
+{
+
+template <typename T>
+void thenCollectionMatches(const LinearCollection<T>& collection, const std::vector<T>& expected)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), begin(expected), end(expected));
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    BOOST_REQUIRE_EQUAL(collection[i], expected[i]);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(GapBufferTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const LinearCollection<int> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getCursor(), 0);
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithInitializerList_ThenItemsAreIndexed)
+{
+  const LinearCollection<std::string> collection = { "Lorem", "ipsum", "dolor" };
+
+  thenCollectionMatches(collection, { "Lorem", "ipsum", "dolor" });
+  BOOST_CHECK_THROW(collection[3], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenInserting_ThenCursorFollowsTheEdit)
+{
+  LinearCollection<char> collection = { 'a', 'd' };
+
+  collection.insert(collection.begin() + 1, 'b');
+  BOOST_CHECK_EQUAL(collection.getCursor(), 2);
+  collection.insert(collection.begin() + 2, 'c');
+  BOOST_CHECK_EQUAL(collection.getCursor(), 3);
+
+  thenCollectionMatches(collection, { 'a', 'b', 'c', 'd' });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenErasing_ThenCursorStaysAtTheEdit)
+{
+  LinearCollection<int> collection = { 1, 2, 3, 4, 5 };
+
+  collection.erase(collection.begin() + 1);
+  BOOST_CHECK_EQUAL(collection.getCursor(), 1);
+  collection.erase(collection.begin() + 1, collection.begin() + 3);
+  BOOST_CHECK_EQUAL(collection.getCursor(), 1);
+
+  thenCollectionMatches(collection, { 1, 5 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPoppingOrErasing_ThenOperationThrows)
+{
+  LinearCollection<int> collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(collection.begin()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPoppingFirstAndLast_ThenEndsAreReturned)
+{
+  LinearCollection<int> collection = { 1, 2, 3 };
+
+  BOOST_CHECK_EQUAL(collection.popFirst(), 1);
+  BOOST_CHECK_EQUAL(collection.popLast(), 3);
+  thenCollectionMatches(collection, { 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomEdits_WhenCollectionGrowsAndShrinks_ThenItMatchesReference)
+{
+  LinearCollection<std::string> collection;
+  std::vector<std::string> expected;
+  std::size_t seed = 2024;
+  auto random = [&seed]() {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<std::size_t>(seed >> 33);
+  };
+
+  std::size_t cursor = 0;
+  for (int round = 0; round < 10000; ++round)
+  {
+    // mostly edits around the cursor, now and then a jump
+    if (random() % 16 == 0)
+      cursor = random() % (expected.size() + 1);
+    cursor = std::min(cursor, expected.size());
+
+    if (random() % 3 != 0 || expected.empty())
+    {
+      collection.insert(collection.cbegin() + cursor, std::to_string(round));
+      expected.insert(expected.begin() + cursor, std::to_string(round));
+      ++cursor;
+    }
+    else
+    {
+      std::size_t position = cursor == expected.size() ? cursor - 1 : cursor;
+      collection.erase(collection.cbegin() + position);
+      expected.erase(expected.begin() + position);
+      cursor = position;
+    }
+  }
+
+  thenCollectionMatches(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenCopiedAndMoved_ThenItemsAreKept)
+{
+  LinearCollection<std::string> collection = { "Lorem", "ipsum" };
+
+  LinearCollection<std::string> copy(collection);
+  copy[0] = "dolor";
+  LinearCollection<std::string> moved(std::move(collection));
+
+  BOOST_CHECK(collection.isEmpty());
+  thenCollectionMatches(moved, { "Lorem", "ipsum" });
+  thenCollectionMatches(copy, { "dolor", "ipsum" });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,216 @@
+#include <IntrusiveList.h>
+
+#include <initializer_list>
+#include <cstddef>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+struct Connection
+{
+  Connection(int id_ = 0)
+    : id(id_)
+  {
+  }
+
+  operator int() const
+  {
+    return id;
+  }
+
+  int id;
+  aisdi::IntrusiveListHook stateHook;
+  aisdi::IntrusiveListHook timeoutHook;
+};
+
+using StateList = aisdi::IntrusiveList<Connection, &Connection::stateHook>;
+using TimeoutList = aisdi::IntrusiveList<Connection, &Connection::timeoutHook>;
+
+} // namespace
+
+using std::begin;
+using std::end;
+
+BOOST_AUTO_TEST_SUITE(IntrusiveListTests)
+
+template <typename List>
+void thenCollectionContainsValues(const List& collection,
+                                  std::initializer_list<int> expected)
+{
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection),
+                                begin(expected), end(expected));
+}
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const StateList collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenAppendingAndPrependingItems_ThenTheyAreLinkedInOrder)
+{
+  Connection a(1), b(2), c(3);
+  StateList collection;
+
+  collection.append(b);
+  collection.append(c);
+  collection.prepend(a);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 3);
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+  BOOST_CHECK(b.stateHook.isLinked());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenIteratingOverItems_ThenOriginalObjectsAreReturned)
+{
+  Connection a(1);
+  StateList collection;
+  collection.append(a);
+
+  BOOST_CHECK_EQUAL(&*collection.begin(), &a);
+}
+
+BOOST_AUTO_TEST_CASE(GivenLinkedItem_WhenAppendingItToTheSameList_ThenOperationThrows)
+{
+  Connection a(1);
+  StateList collection;
+  collection.append(a);
+
+  BOOST_CHECK_THROW(collection.append(a), std::logic_error);
+  BOOST_CHECK_EQUAL(collection.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenItem_WhenLinkingItUsingDifferentHooks_ThenItIsInBothLists)
+{
+  Connection a(1), b(2);
+  StateList active;
+  TimeoutList timeouts;
+
+  active.append(a);
+  active.append(b);
+  timeouts.append(b);
+
+  thenCollectionContainsValues(active, { 1, 2 });
+  thenCollectionContainsValues(timeouts, { 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenItemInOneList_WhenMovingItToAnother_ThenItIsOnlyInTheSecondOne)
+{
+  Connection a(1), b(2), c(3);
+  StateList idle, active;
+  idle.append(a);
+  idle.append(b);
+  idle.append(c);
+
+  idle.remove(b);
+  active.append(b);
+
+  thenCollectionContainsValues(idle, { 1, 3 });
+  thenCollectionContainsValues(active, { 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenUnlinkedItem_WhenRemoving_ThenOperationThrows)
+{
+  Connection a(1);
+  StateList collection;
+
+  BOOST_CHECK_THROW(collection.remove(a), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPoppingItem_ThenOperationThrows)
+{
+  StateList collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPoppingItems_ThenTheyAreUnlinkedAndReturned)
+{
+  Connection a(1), b(2), c(3);
+  StateList collection;
+  collection.append(a);
+  collection.append(b);
+  collection.append(c);
+
+  BOOST_CHECK_EQUAL(&collection.popFirst(), &a);
+  BOOST_CHECK_EQUAL(&collection.popLast(), &c);
+  BOOST_CHECK(!a.stateHook.isLinked());
+  BOOST_CHECK(!c.stateHook.isLinked());
+  thenCollectionContainsValues(collection, { 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenInsertingInTheMiddle_ThenItemIsLinkedBeforePosition)
+{
+  Connection a(1), b(2), c(3);
+  StateList collection;
+  collection.append(a);
+  collection.append(c);
+
+  collection.insert(begin(collection) + 1, b);
+
+  thenCollectionContainsValues(collection, { 1, 2, 3 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenErasingItems_ThenTheyAreUnlinked)
+{
+  Connection a(1), b(2), c(3), d(4);
+  StateList collection;
+  collection.append(a);
+  collection.append(b);
+  collection.append(c);
+  collection.append(d);
+
+  collection.erase(collection.iteratorTo(b));
+  collection.erase(begin(collection) + 1, end(collection));
+
+  thenCollectionContainsValues(collection, { 1 });
+  BOOST_CHECK_EQUAL(collection.getSize(), 1);
+  BOOST_CHECK_THROW(collection.erase(end(collection)), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenDestroyed_ThenItemsAreUnlinked)
+{
+  Connection a(1);
+  {
+    StateList collection;
+    collection.append(a);
+  }
+
+  BOOST_CHECK(!a.stateHook.isLinked());
+}
+
+BOOST_AUTO_TEST_CASE(GivenLinkedItem_WhenCopyingIt_ThenCopyIsNotLinked)
+{
+  Connection a(1);
+  StateList collection;
+  collection.append(a);
+
+  Connection copy(a);
+
+  BOOST_CHECK(!copy.stateHook.isLinked());
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenMovingIt_ThenItemsAreRelinkedToTheNewList)
+{
+  Connection a(1), b(2);
+  StateList collection;
+  collection.append(a);
+  collection.append(b);
+
+  StateList other(std::move(collection));
+
+  BOOST_CHECK(collection.isEmpty());
+  thenCollectionContainsValues(other, { 1, 2 });
+  BOOST_CHECK_EQUAL(&other.popLast(), &b);
+  BOOST_CHECK_EQUAL(&other.popLast(), &a);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,257 @@
+#include <JaggedVector.h>
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+template <typename T>
+using Rows = std::vector<std::vector<T>>;
+
+template <typename T>
+void thenCollectionContainsRows(const aisdi::JaggedVector<T>& collection, const Rows<T>& expected)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+
+  std::size_t valueCount = 0;
+  auto it = collection.begin();
+  for (std::size_t i = 0; i < expected.size(); ++i, ++it)
+  {
+    std::span<const T> row = collection[i];
+    BOOST_CHECK_EQUAL_COLLECTIONS(row.begin(), row.end(), expected[i].begin(), expected[i].end());
+    BOOST_CHECK((*it).data() == row.data() && (*it).size() == row.size());
+    valueCount += expected[i].size();
+  }
+  BOOST_CHECK(it == collection.end());
+  BOOST_CHECK_EQUAL(collection.getValueCount(), valueCount);
+}
+
+// throws once copiesLeft runs out; a negative budget never runs out
+struct ThrowingCopy
+{
+  static int alive;
+  static int copiesLeft;
+
+  int value;
+
+  ThrowingCopy(int value) : value(value)
+  {
+    ++alive;
+  }
+
+  ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+  {
+    if (copiesLeft-- == 0)
+      throw std::runtime_error("copy failed");
+    ++alive;
+  }
+
+  ThrowingCopy(ThrowingCopy&& other) : value(other.value)
+  {
+    ++alive;
+  }
+
+  ~ThrowingCopy()
+  {
+    --alive;
+  }
+};
+
+int ThrowingCopy::alive = 0;
+int ThrowingCopy::copiesLeft = -1;
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(JaggedVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const aisdi::JaggedVector<int> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getValueCount(), 0);
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK_THROW(collection[0], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPoppingLastRow_ThenExceptionIsThrown)
+{
+  aisdi::JaggedVector<int> collection;
+
+  BOOST_CHECK_THROW(collection.popLastRow(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAppendingRows_ThenTheyAreStoredBackToBack)
+{
+  aisdi::JaggedVector<int> collection;
+  collection.appendRow({ 1, 2, 3 });
+  collection.appendRow({});
+  std::vector<int> row = { 4, 5 };
+  collection.appendRow(row);
+
+  thenCollectionContainsRows<int>(collection, { { 1, 2, 3 }, {}, { 4, 5 } });
+  std::span<const int> values = static_cast<const aisdi::JaggedVector<int>&>(collection).getValues();
+  BOOST_CHECK_EQUAL(values.size(), 5);
+  BOOST_CHECK_EQUAL(values[3], 4);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenRowIsModifiedThroughSpan_ThenValueIsChanged)
+{
+  aisdi::JaggedVector<int> collection = { { 1, 2 }, { 3 } };
+
+  collection[0][1] = 20;
+
+  thenCollectionContainsRows<int>(collection, { { 1, 20 }, { 3 } });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenPoppingLastRow_ThenItsValuesAreDropped)
+{
+  aisdi::JaggedVector<std::string> collection = { { "Lorem", "ipsum" }, { "dolor", "sit", "amet" } };
+
+  collection.popLastRow();
+  collection.appendRow({ "consectetur" });
+
+  thenCollectionContainsRows<std::string>(collection, { { "Lorem", "ipsum" }, { "consectetur" } });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAppendingItsOwnRow_ThenItIsCopiedBeforeGrowing)
+{
+  aisdi::JaggedVector<std::string> collection;
+  collection.appendRow(std::vector<std::string>(40, "adipiscing"));
+
+  collection.appendRow(collection[0]);
+  collection.appendRow(collection[1]);
+
+  thenCollectionContainsRows<std::string>(collection, Rows<std::string>(3, std::vector<std::string>(40, "adipiscing")));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopyOfRowValueThrows_ThenNoValueOfTheRowIsKept)
+{
+  {
+    aisdi::JaggedVector<ThrowingCopy> collection;
+    collection.appendRow({ 1, 2 });
+
+    const ThrowingCopy row[] = { 3, 4, 5 };
+    ThrowingCopy::copiesLeft = 2;
+    BOOST_CHECK_THROW(collection.appendRow(row), std::runtime_error);
+    ThrowingCopy::copiesLeft = -1;
+
+    BOOST_CHECK_EQUAL(collection.getValueCount(), 2);
+    BOOST_CHECK_EQUAL(ThrowingCopy::alive, 5);
+
+    collection.appendRow({ 6 });
+    BOOST_REQUIRE_EQUAL(collection.getSize(), 2);
+    BOOST_REQUIRE_EQUAL(collection[1].size(), 1);
+    BOOST_CHECK_EQUAL(collection[1][0].value, 6);
+  }
+  BOOST_CHECK_EQUAL(ThrowingCopy::alive, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopyAssignmentThrows_ThenNoValueIsLeftBehind)
+{
+  {
+    aisdi::JaggedVector<ThrowingCopy> source;
+    source.appendRow({ 1, 2, 3 });
+    aisdi::JaggedVector<ThrowingCopy> collection;
+    collection.appendRow({ 4 });
+
+    ThrowingCopy::copiesLeft = 2;
+    BOOST_CHECK_THROW(collection = source, std::runtime_error);
+    ThrowingCopy::copiesLeft = -1;
+
+    BOOST_CHECK(collection.isEmpty());
+    BOOST_CHECK_EQUAL(collection.getValueCount(), 0);
+    BOOST_CHECK_EQUAL(ThrowingCopy::alive, 3);
+
+    collection.appendRow({ 5 });
+    BOOST_REQUIRE_EQUAL(collection[0].size(), 1);
+    BOOST_CHECK_EQUAL(collection[0][0].value, 5);
+  }
+  BOOST_CHECK_EQUAL(ThrowingCopy::alive, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenAdjacencyLists_WhenBuiltWithBuilder_ThenRowsMatch)
+{
+  Rows<int> expected;
+  aisdi::JaggedVector<int>::Builder builder(1000, 4500);
+  for (int vertex = 0; vertex < 1000; ++vertex)
+  {
+    expected.emplace_back();
+    for (int neighbour = 0; neighbour < vertex % 10; ++neighbour)
+    {
+      builder.append(vertex + neighbour);
+      expected.back().push_back(vertex + neighbour);
+    }
+    builder.endRow();
+  }
+  BOOST_CHECK_EQUAL(builder.getSize(), 1000);
+
+  const aisdi::JaggedVector<int> collection = builder.build();
+
+  thenCollectionContainsRows(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenBuilderWithOpenRow_WhenBuilding_ThenOpenRowBecomesLastRow)
+{
+  aisdi::JaggedVector<int>::Builder builder;
+  builder.append(1).append(2).endRow().append(3);
+
+  const aisdi::JaggedVector<int> collection = builder.build();
+
+  thenCollectionContainsRows<int>(collection, { { 1, 2 }, { 3 } });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopied_ThenCopyIsIndependent)
+{
+  aisdi::JaggedVector<std::string> collection = { { "Praesent" }, { "posuere", "tortor" } };
+  aisdi::JaggedVector<std::string> other(collection);
+
+  other.appendRow({ "quis" });
+  collection[0][0] = "iaculis";
+
+  thenCollectionContainsRows<std::string>(collection, { { "iaculis" }, { "posuere", "tortor" } });
+  thenCollectionContainsRows<std::string>(other, { { "Praesent" }, { "posuere", "tortor" }, { "quis" } });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopyAssigned_ThenRowsAreReplaced)
+{
+  const aisdi::JaggedVector<std::string> collection = { { "nec" }, {} };
+  aisdi::JaggedVector<std::string> other = { { "malesuada", "semper" } };
+
+  other = collection;
+
+  thenCollectionContainsRows<std::string>(other, { { "nec" }, {} });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenMoved_ThenRowsAreTransferred)
+{
+  aisdi::JaggedVector<std::string> collection = { { "faucibus" }, { "lectus", "Morbi" } };
+  aisdi::JaggedVector<std::string> other(std::move(collection));
+
+  thenCollectionContainsRows<std::string>(other, { { "faucibus" }, { "lectus", "Morbi" } });
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenIteratingBackwards_ThenRowsAreVisitedInReverse)
+{
+  const aisdi::JaggedVector<int> collection = { { 1 }, { 2, 3 } };
+
+  auto it = collection.end();
+  BOOST_CHECK_EQUAL((*--it).size(), 2);
+  BOOST_CHECK_EQUAL((*--it)[0], 1);
+  BOOST_CHECK_THROW(--it, std::out_of_range);
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(collection.end() + 1, std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -137,7 +137,7 @@ using TestedTypes = boost::mpl::list<std::int32_t,
 using std::begin;
 using std::end;
 
-BOOST_FIXTURE_TEST_SUITE(VectorTests, Fixture)
+BOOST_FIXTURE_TEST_SUITE(LinkedListTests, Fixture)
 
 template <typename T>
 void thenCollectionContainsValues(const LinearCollection<T>& collection,
@@ -931,6 +931,98 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingRange_ThenSizeI
   BOOST_CHECK_EQUAL(collection.getSize(), 2);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyCollection_WhenCallingForEach_ThenFunctionIsNotCalled,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  std::size_t calls = 0;
+
+  collection.forEach([&calls](T&) { ++calls; });
+
+  BOOST_CHECK_EQUAL(calls, 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenCallingForEach_ThenItemsCanBeChanged,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3, 4, 5, 6, 7 };
+
+  collection.forEach([](T& item) { item = T{}; });
+
+  thenCollectionContainsValues(collection, { 0, 0, 0, 0, 0, 0, 0 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollectionShorterThanPrefetchDistance_WhenCallingForEach_ThenAllItemsAreVisited,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection = { 10, 20, 30 };
+  LinearCollection<T> visited;
+
+  collection.template forEach<16>([&visited](const T& item) { visited.append(item); });
+
+  thenCollectionContainsValues(visited, { 10, 20, 30 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenSmallPrefetchDistances_WhenCallingForEach_ThenAllItemsAreVisited,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection = { 10, 20, 30 };
+  LinearCollection<T> visitedWithoutLookahead;
+  LinearCollection<T> visitedOneAhead;
+
+  collection.template forEach<0>([&](const T& item) { visitedWithoutLookahead.append(item); });
+  collection.template forEach<1>([&](const T& item) { visitedOneAhead.append(item); });
+
+  thenCollectionContainsValues(visitedWithoutLookahead, { 10, 20, 30 });
+  thenCollectionContainsValues(visitedOneAhead, { 10, 20, 30 });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenAccumulating_ThenOperationIsAppliedToEveryItem,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection = { 3, 1, 4, 1, 5, 9, 2, 6 };
+
+  auto count = collection.accumulate(std::size_t{}, [](std::size_t acc, const T&) { return acc + 1; });
+
+  BOOST_CHECK_EQUAL(count, collection.getSize());
+}
+
+BOOST_AUTO_TEST_CASE(GivenIntegerCollection_WhenAccumulatingWithoutOperation_ThenSumIsReturned)
+{
+  const LinearCollection<int> collection = { 3, 1, 4, 1, 5, 9, 2, 6 };
+
+  BOOST_CHECK_EQUAL(collection.accumulate(0), 31);
+  BOOST_CHECK_EQUAL(collection.accumulate<0>(100), 131);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenFindingExistingItem_ThenIteratorToFirstMatchIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 10, 20, 30, 20 };
+
+  auto it = collection.findIf([](const T& item) { return item == T(20); });
+
+  BOOST_CHECK(it == begin(collection) + 1);
+  BOOST_CHECK_EQUAL(*it, 20);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenFindingMissingItem_ThenEndIsReturned,
+                              T,
+                              TestedTypes)
+{
+  const LinearCollection<T> collection = { 10, 20, 30 };
+
+  auto it = collection.findIf([](const T& item) { return item == T(40); });
+
+  BOOST_CHECK(it == collection.cend());
+}
+
 // ConstIterator is tested via Iterator methods.
 // If Iterator methods are to be changed, then new ConstIterator tests are required.
 
@@ -0,0 +1,246 @@
+#include <PolyVector.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+int liveEvents = 0;
+
+struct Event
+{
+  Event() { ++liveEvents; }
+  Event(const Event&) { ++liveEvents; }
+  Event(Event&&) { ++liveEvents; }
+  virtual ~Event() { --liveEvents; }
+
+  virtual std::string describe() const = 0;
+};
+
+struct Click : Event
+{
+  int x;
+  int y;
+
+  Click(int x, int y) : x(x), y(y) {}
+
+  std::string describe() const override
+  {
+    return "click " + std::to_string(x) + "," + std::to_string(y);
+  }
+};
+
+struct KeyPress : Event
+{
+  std::string key;
+
+  explicit KeyPress(std::string key) : key(std::move(key)) {}
+
+  std::string describe() const override
+  {
+    return "key " + key;
+  }
+};
+
+struct Tag
+{
+  std::uint64_t tag = 7;
+  virtual ~Tag() = default;
+};
+
+// Event is not the first base, so it does not start at the object address
+struct Tagged : Tag, Event
+{
+  std::string describe() const override
+  {
+    return "tagged " + std::to_string(tag);
+  }
+};
+
+struct alignas(16) Aligned : Event
+{
+  double values[2] = { 1.5, 2.5 };
+
+  std::string describe() const override
+  {
+    return "aligned " + std::to_string(reinterpret_cast<std::uintptr_t>(this) % 16);
+  }
+};
+
+struct Owning : Event
+{
+  std::unique_ptr<int> value;
+
+  explicit Owning(int value) : value(std::make_unique<int>(value)) {}
+
+  std::string describe() const override
+  {
+    return "owning " + std::to_string(*value);
+  }
+};
+
+std::vector<std::string> describeAll(const aisdi::PolyVector<Event>& collection)
+{
+  std::vector<std::string> descriptions;
+  for (const Event& event : collection)
+    descriptions.push_back(event.describe());
+  return descriptions;
+}
+
+void thenCollectionDescribes(const aisdi::PolyVector<Event>& collection, const std::vector<std::string>& expected)
+{
+  std::vector<std::string> descriptions = describeAll(collection);
+  BOOST_CHECK_EQUAL(collection.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(descriptions.begin(), descriptions.end(), expected.begin(), expected.end());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(PolyVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const aisdi::PolyVector<Event> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getUsedBytes(), 0);
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK_THROW(*collection.begin(), std::out_of_range);
+  BOOST_CHECK_THROW(++collection.begin(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAddingDifferentTypes_ThenTheyAreIteratedAsBase)
+{
+  aisdi::PolyVector<Event> collection;
+  collection.emplace<Click>(3, 4);
+  collection.append(KeyPress("Enter"));
+  collection.emplace<Tagged>();
+  Aligned& aligned = collection.emplace<Aligned>();
+
+  BOOST_CHECK_EQUAL(aligned.values[1], 2.5);
+  thenCollectionDescribes(collection, { "click 3,4", "key Enter", "tagged 7", "aligned 0" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenIteratingWithMutableIterator_ThenItemsCanBeModified)
+{
+  aisdi::PolyVector<Event> collection;
+  collection.emplace<Click>(1, 1);
+  collection.emplace<Click>(2, 2);
+
+  for (auto it = collection.begin(); it != collection.end(); ++it)
+    static_cast<Click&>(*it).x *= 10;
+
+  thenCollectionDescribes(collection, { "click 10,1", "click 20,2" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyItems_WhenBufferGrows_ThenItemsAreRelocated)
+{
+  liveEvents = 0;
+  {
+    aisdi::PolyVector<Event> collection;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 2000; ++i)
+    {
+      switch (i % 4)
+      {
+        case 0:
+          collection.emplace<Click>(i, -i);
+          expected.push_back("click " + std::to_string(i) + "," + std::to_string(-i));
+          break;
+        case 1:
+          collection.emplace<KeyPress>("a rather long key name " + std::to_string(i));
+          expected.push_back("key a rather long key name " + std::to_string(i));
+          break;
+        case 2:
+          collection.emplace<Aligned>();
+          expected.push_back("aligned 0");
+          break;
+        default:
+          collection.emplace<Owning>(i);
+          expected.push_back("owning " + std::to_string(i));
+      }
+    }
+
+    thenCollectionDescribes(collection, expected);
+    BOOST_CHECK_EQUAL(liveEvents, 2000);
+  }
+  BOOST_CHECK_EQUAL(liveEvents, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAddingCopyOfItsOwnItem_ThenItIsCopiedBeforeGrowing)
+{
+  aisdi::PolyVector<Event> collection;
+  const KeyPress& first = collection.emplace<KeyPress>(std::string(100, 'k'));
+  while (collection.getUsedBytes() + 48 < 1024)
+    collection.emplace<Click>(0, 0);
+
+  collection.emplace<KeyPress>(first);
+
+  BOOST_CHECK_EQUAL(describeAll(collection).back(), "key " + std::string(100, 'k'));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCleared_ThenItemsAreDestroyed)
+{
+  liveEvents = 0;
+  aisdi::PolyVector<Event> collection;
+  collection.emplace<Click>(1, 2);
+  collection.emplace<KeyPress>("Esc");
+
+  collection.clear();
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(liveEvents, 0);
+  collection.emplace<Tagged>();
+  thenCollectionDescribes(collection, { "tagged 7" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopied_ThenCopyIsIndependent)
+{
+  aisdi::PolyVector<Event> collection;
+  collection.emplace<Click>(5, 6);
+  collection.emplace<KeyPress>("Tab");
+  aisdi::PolyVector<Event> other(collection);
+
+  other.emplace<Tagged>();
+  static_cast<Click&>(*collection.begin()).y = 60;
+
+  thenCollectionDescribes(collection, { "click 5,60", "key Tab" });
+  thenCollectionDescribes(other, { "click 5,6", "key Tab", "tagged 7" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithMoveOnlyItem_WhenCopied_ThenExceptionIsThrown)
+{
+  aisdi::PolyVector<Event> collection;
+  collection.emplace<Owning>(1);
+  aisdi::PolyVector<Event> other;
+  other.emplace<Click>(1, 1);
+
+  BOOST_CHECK_THROW(other = collection, std::logic_error);
+  thenCollectionDescribes(other, { "click 1,1" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenMoved_ThenItemsAreTransferred)
+{
+  aisdi::PolyVector<Event> collection;
+  collection.emplace<Owning>(42);
+  aisdi::PolyVector<Event> other(std::move(collection));
+
+  BOOST_CHECK(collection.isEmpty());
+  thenCollectionDescribes(other, { "owning 42" });
+
+  collection = std::move(other);
+  thenCollectionDescribes(collection, { "owning 42" });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
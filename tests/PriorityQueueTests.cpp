@@ -0,0 +1,238 @@
+#include <PriorityQueue.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+#include <boost/mpl/list.hpp>
+
+namespace
+{
+
+template <std::size_t Arity>
+using MinQueue = aisdi::PriorityQueue<int, std::greater<int>, Arity>;
+
+using TestedQueues = boost::mpl::list<MinQueue<2>, MinQueue<3>, MinQueue<4>, MinQueue<8>>;
+
+template <typename Queue>
+std::vector<int> popAll(Queue& queue)
+{
+  std::vector<int> popped;
+  while (!queue.isEmpty())
+    popped.push_back(queue.pop());
+  return popped;
+}
+
+// deterministic pseudo-random values with duplicates
+std::vector<int> givenValues(std::size_t count)
+{
+  std::vector<int> values;
+  for (std::size_t i = 0; i < count; ++i)
+    values.push_back(static_cast<int>((i * 7919) % 1000));
+  return values;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(PriorityQueueTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenEmptyQueue_WhenTakingTop_ThenExceptionIsThrown,
+                              Queue,
+                              TestedQueues)
+{
+  Queue queue;
+
+  BOOST_CHECK(queue.isEmpty());
+  BOOST_CHECK_THROW(queue.top(), std::logic_error);
+  BOOST_CHECK_THROW(queue.pop(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenQueue_WhenPushingAndPopping_ThenOrderMatchesStdPriorityQueue,
+                              Queue,
+                              TestedQueues)
+{
+  Queue queue;
+  std::priority_queue<int, std::vector<int>, std::greater<int>> reference;
+  for (int value : givenValues(3000))
+  {
+    queue.push(value);
+    reference.push(value);
+    if (value % 3 == 0)
+    {
+      BOOST_REQUIRE_EQUAL(queue.top(), reference.top());
+      BOOST_REQUIRE_EQUAL(queue.pop(), reference.top());
+      reference.pop();
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(queue.getSize(), reference.size());
+  while (!reference.empty())
+  {
+    BOOST_REQUIRE_EQUAL(queue.pop(), reference.top());
+    reference.pop();
+  }
+  BOOST_CHECK(queue.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenRange_WhenHeapified_ThenItemsArePoppedInOrder,
+                              Queue,
+                              TestedQueues)
+{
+  std::vector<int> values = givenValues(1000);
+  Queue queue(values.begin(), values.end());
+  queue.heapify(values.begin(), values.begin() + 100);
+
+  values.insert(values.end(), values.begin(), values.begin() + 100);
+  std::sort(values.begin(), values.end());
+  std::vector<int> popped = popAll(queue);
+  BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), values.begin(), values.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenDefaultCompare_WhenPopping_ThenLargestItemComesFirst)
+{
+  aisdi::PriorityQueue<int> queue = { 3, 1, 4, 1, 5, 9, 2, 6 };
+
+  BOOST_CHECK_EQUAL(queue.top(), 9);
+  std::vector<int> popped = popAll(queue);
+  std::vector<int> expected = { 9, 6, 5, 4, 3, 2, 1, 1 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenDaryHeapOfStrings_WhenEmplacing_ThenItemsAreMovedOut)
+{
+  static_assert(std::is_same<aisdi::DaryHeap<std::string, std::greater<std::string>>,
+                             aisdi::PriorityQueue<std::string, std::greater<std::string>, 4>>::value,
+                "DaryHeap takes its parameters in the PriorityQueue order");
+  aisdi::DaryHeap<std::string, std::greater<std::string>> queue;
+  queue.emplace(3, 'c');
+  queue.push(std::string("aa"));
+  const std::string b = "b";
+  queue.push(b);
+
+  BOOST_CHECK_EQUAL(queue.pop(), "aa");
+  BOOST_CHECK_EQUAL(queue.pop(), "b");
+  BOOST_CHECK_EQUAL(queue.pop(), "ccc");
+}
+
+BOOST_AUTO_TEST_CASE(GivenQueue_WhenCopied_ThenCopyIsIndependent)
+{
+  aisdi::DaryHeap<int> queue = { 1, 2, 3 };
+  aisdi::DaryHeap<int> other(queue);
+
+  other.push(10);
+  queue.pop();
+
+  BOOST_CHECK_EQUAL(queue.top(), 2);
+  BOOST_CHECK_EQUAL(other.top(), 10);
+  BOOST_CHECK_EQUAL(other.getSize(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIndexedQueue_WhenDecreasingKey_ThenItemMovesTowardsTop)
+{
+  aisdi::IndexedPriorityQueue<int, std::greater<int>, 4> queue;
+  std::vector<aisdi::IndexedPriorityQueue<int, std::greater<int>, 4>::Handle> handles;
+  for (int i = 0; i < 100; ++i)
+    handles.push_back(queue.push(100 + i));
+
+  queue.decreaseKey(handles[70], 5);
+
+  BOOST_CHECK_EQUAL(queue.top(), 5);
+  BOOST_CHECK_EQUAL(queue.topHandle(), handles[70]);
+  BOOST_CHECK_EQUAL(queue[handles[70]], 5);
+  BOOST_CHECK_THROW(queue.decreaseKey(handles[10], 500), std::invalid_argument);
+  BOOST_CHECK_EQUAL(queue.pop(), 5);
+  BOOST_CHECK(!queue.contains(handles[70]));
+  BOOST_CHECK_THROW(queue[handles[70]], std::out_of_range);
+  BOOST_CHECK_EQUAL(queue.pop(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIndexedQueue_WhenUpdatingAndErasing_ThenOrderIsKept)
+{
+  aisdi::IndexedPriorityQueue<int, std::greater<int>> queue;
+  std::vector<std::size_t> handles;
+  for (int value : givenValues(500))
+    handles.push_back(queue.push(value));
+
+  std::multiset<int> expected;
+  for (std::size_t i = 0; i < handles.size(); ++i)
+  {
+    if (i % 5 == 0)
+      queue.erase(handles[i]);
+    else
+    {
+      int value = static_cast<int>((i * 31) % 1000);
+      queue.update(handles[i], value);
+      expected.insert(value);
+    }
+  }
+
+  std::vector<int> popped = popAll(queue);
+  BOOST_CHECK_EQUAL_COLLECTIONS(popped.begin(), popped.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenIndexedQueue_WhenItemLeaves_ThenItsHandleIsReused)
+{
+  aisdi::IndexedPriorityQueue<std::string> queue;
+  auto first = queue.push("Lorem");
+  queue.push("ipsum");
+
+  BOOST_CHECK_EQUAL(queue.erase(first), "Lorem");
+  BOOST_CHECK_THROW(queue.erase(first), std::out_of_range);
+  auto reused = queue.push("dolor");
+
+  BOOST_CHECK_EQUAL(reused, first);
+  BOOST_CHECK_EQUAL(queue.top(), "ipsum");
+  BOOST_CHECK_EQUAL(queue[reused], "dolor");
+}
+
+BOOST_AUTO_TEST_CASE(GivenGraph_WhenRunningDijkstraWithDecreaseKey_ThenDistancesAreShortest)
+{
+  // (to, weight) pairs of every vertex
+  const std::vector<std::vector<std::pair<std::size_t, int>>> edges = {
+    { { 1, 7 }, { 2, 9 }, { 5, 14 } },
+    { { 0, 7 }, { 2, 10 }, { 3, 15 } },
+    { { 0, 9 }, { 1, 10 }, { 3, 11 }, { 5, 2 } },
+    { { 1, 15 }, { 2, 11 }, { 4, 6 } },
+    { { 3, 6 }, { 5, 9 } },
+    { { 0, 14 }, { 2, 2 }, { 4, 9 } }
+  };
+  const int infinity = 1 << 30;
+
+  using Queue = aisdi::IndexedPriorityQueue<std::pair<int, std::size_t>, std::greater<std::pair<int, std::size_t>>, 4>;
+  Queue queue;
+  std::vector<Queue::Handle> handles;
+  std::vector<int> distances(edges.size(), infinity);
+  distances[0] = 0;
+  for (std::size_t vertex = 0; vertex < edges.size(); ++vertex)
+    handles.push_back(queue.push({ distances[vertex], vertex }));
+
+  while (!queue.isEmpty())
+  {
+    auto [distance, vertex] = queue.pop();
+    for (auto [to, weight] : edges[vertex])
+    {
+      if (queue.contains(handles[to]) && distance + weight < distances[to])
+      {
+        distances[to] = distance + weight;
+        queue.decreaseKey(handles[to], { distances[to], to });
+      }
+    }
+  }
+
+  std::vector<int> expected = { 0, 7, 9, 20, 20, 11 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(distances.begin(), distances.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,252 @@
+#include <RingQueue.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+// copying (or assigning) throws once the budget of copies (or assignments)
+// is spent
+struct ThrowingCopy
+{
+  static int copiesLeft;
+  static int assignmentsLeft;
+
+  int value;
+
+  ThrowingCopy(int value = 0) : value(value) {}
+
+  ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+  {
+    if (copiesLeft-- == 0)
+      throw std::runtime_error("copy failed");
+  }
+
+  ThrowingCopy& operator=(const ThrowingCopy& other)
+  {
+    if (assignmentsLeft-- == 0)
+      throw std::runtime_error("assignment failed");
+    value = other.value;
+    return *this;
+  }
+};
+
+int ThrowingCopy::copiesLeft = -1;
+int ThrowingCopy::assignmentsLeft = -1;
+
+} // namespace
+
+template <typename T>
+using ConcurrentCollection = aisdi::RingQueue<T>;
+
+BOOST_AUTO_TEST_SUITE(RingQueueTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreated_ThenItIsEmptyAndCapacityIsPowerOfTwo)
+{
+  ConcurrentCollection<int> collection(100);
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 128);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPopping_ThenOperationFails)
+{
+  ConcurrentCollection<int> collection(4);
+  int item = 7;
+
+  BOOST_CHECK(!collection.tryPop(item));
+  BOOST_CHECK_EQUAL(item, 7);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPopping_ThenItemsAreReturnedInFifoOrder)
+{
+  ConcurrentCollection<std::string> collection(4);
+  collection.tryPush("Lorem");
+  collection.tryPush("ipsum");
+
+  std::string item;
+  BOOST_CHECK(collection.tryPop(item));
+  BOOST_CHECK_EQUAL(item, "Lorem");
+  BOOST_CHECK(collection.tryPop(item));
+  BOOST_CHECK_EQUAL(item, "ipsum");
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullCollection_WhenPushing_ThenOperationFails)
+{
+  ConcurrentCollection<int> collection(4);
+  for (int i = 0; i < 4; ++i)
+    BOOST_CHECK(collection.tryPush(i));
+
+  BOOST_CHECK(!collection.tryPush(4));
+
+  int item;
+  collection.tryPop(item);
+  BOOST_CHECK(collection.tryPush(4));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenWrappingAroundManyTimes_ThenOrderIsPreserved)
+{
+  ConcurrentCollection<int> collection(4);
+  collection.tryPush(0);
+  collection.tryPush(1);
+  int item;
+
+  for (int i = 0; i < 100; ++i)
+  {
+    BOOST_CHECK(collection.tryPush(i + 2));
+    BOOST_CHECK(collection.tryPop(item));
+    BOOST_CHECK_EQUAL(item, i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenPushingBatchLargerThanFreeSpace_ThenPrefixIsPushed)
+{
+  ConcurrentCollection<int> collection(4);
+  collection.tryPush(0);
+  const std::vector<int> batch = { 1, 2, 3, 4, 5 };
+
+  BOOST_CHECK_EQUAL(collection.tryPushBatch(batch.begin(), batch.end()), 3);
+
+  std::vector<int> popped(8, -1);
+  BOOST_CHECK_EQUAL(collection.tryPopBatch(popped.begin(), popped.size()), 4);
+  BOOST_CHECK_EQUAL(popped[0], 0);
+  BOOST_CHECK_EQUAL(popped[3], 3);
+  BOOST_CHECK_EQUAL(popped[4], -1);
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingCopy_WhenPushing_ThenQueueKeepsWorking)
+{
+  ConcurrentCollection<ThrowingCopy> collection(8);
+  const std::vector<ThrowingCopy> batch = { 1, 2, 3, 4 };
+
+  ThrowingCopy::copiesLeft = 1;
+  BOOST_CHECK_THROW(collection.tryPushBatch(batch.begin(), batch.end()), std::runtime_error);
+  ThrowingCopy::copiesLeft = 0;
+  BOOST_CHECK_THROW(collection.tryPush(ThrowingCopy(5)), std::runtime_error);
+  ThrowingCopy::copiesLeft = -1;
+  BOOST_CHECK(collection.tryPush(ThrowingCopy(6)));
+  BOOST_CHECK(collection.tryPush(ThrowingCopy(7)));
+
+  ThrowingCopy item;
+  BOOST_CHECK(collection.tryPop(item));
+  BOOST_CHECK_EQUAL(item.value, 1);
+  BOOST_CHECK(collection.tryPop(item));
+  BOOST_CHECK_EQUAL(item.value, 6);
+  std::vector<ThrowingCopy> popped(4);
+  BOOST_CHECK_EQUAL(collection.tryPopBatch(popped.begin(), popped.size()), 1);
+  BOOST_CHECK_EQUAL(popped[0].value, 7);
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenThrowingAssignment_WhenPopping_ThenCellsAreHandedBack)
+{
+  ConcurrentCollection<ThrowingCopy> collection(4);
+  for (int i = 0; i < 4; ++i)
+    BOOST_CHECK(collection.tryPush(ThrowingCopy(i)));
+
+  ThrowingCopy item;
+  ThrowingCopy::assignmentsLeft = 0;
+  BOOST_CHECK_THROW(collection.tryPop(item), std::runtime_error);
+  std::vector<ThrowingCopy> popped(4);
+  ThrowingCopy::assignmentsLeft = 1;
+  BOOST_CHECK_THROW(collection.tryPopBatch(popped.begin(), popped.size()), std::runtime_error);
+  ThrowingCopy::assignmentsLeft = -1;
+
+  BOOST_CHECK_EQUAL(popped[0].value, 1);
+  BOOST_CHECK(collection.isEmpty());
+  for (int i = 0; i < 4; ++i)
+    BOOST_CHECK(collection.tryPush(ThrowingCopy(10 + i)));
+  BOOST_CHECK_EQUAL(collection.tryPopBatch(popped.begin(), popped.size()), 4);
+  BOOST_CHECK_EQUAL(popped[3].value, 13);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenDestroyed_ThenRemainingItemsAreReleased)
+{
+  std::shared_ptr<int> counted = std::make_shared<int>(0);
+  {
+    ConcurrentCollection<std::shared_ptr<int>> collection(16);
+    for (int i = 0; i < 10; ++i)
+      collection.tryPush(counted);
+    std::shared_ptr<int> item;
+    collection.tryPop(item);
+  }
+
+  BOOST_CHECK_EQUAL(counted.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyProducersAndConsumers_WhenRunningConcurrently_ThenEveryItemIsPoppedOnce)
+{
+  const std::size_t threadCount = 4;
+  const std::uint64_t itemsPerProducer = 20000;
+  ConcurrentCollection<std::uint64_t> collection(64);
+  std::atomic<std::uint64_t> poppedCount(0);
+  std::atomic<std::uint64_t> poppedSum(0);
+  std::vector<std::thread> threads;
+
+  for (std::size_t t = 0; t < threadCount; ++t)
+  {
+    threads.emplace_back([&collection, t, itemsPerProducer]() {
+      std::uint64_t batch[3];
+      std::uint64_t i = 0;
+      while (i < itemsPerProducer)
+      {
+        std::size_t pushed;
+        if (i % 2)
+        {
+          pushed = collection.tryPush(t * itemsPerProducer + i + 1) ? 1 : 0;
+        }
+        else
+        {
+          std::size_t count = 0;
+          while (count < 3 && i + count < itemsPerProducer)
+          {
+            batch[count] = t * itemsPerProducer + i + count + 1;
+            ++count;
+          }
+          pushed = collection.tryPushBatch(batch, batch + count);
+        }
+
+        if (pushed == 0)
+          std::this_thread::yield();
+        i += pushed;
+      }
+    });
+
+    threads.emplace_back([&collection, &poppedCount, &poppedSum, threadCount, itemsPerProducer]() {
+      std::uint64_t items[5];
+      while (poppedCount.load() < threadCount * itemsPerProducer)
+      {
+        std::size_t count = collection.tryPopBatch(items, 5);
+        if (count == 0)
+          std::this_thread::yield();
+        for (std::size_t i = 0; i < count; ++i)
+          poppedSum += items[i];
+        poppedCount += count;
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  const std::uint64_t total = threadCount * itemsPerProducer;
+  BOOST_CHECK_EQUAL(poppedCount.load(), total);
+  BOOST_CHECK_EQUAL(poppedSum.load(), total * (total + 1) / 2);
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,248 @@
+#include <SlotMap.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+using Map = aisdi::SlotMap<std::string>;
+
+std::vector<std::string> sortedItems(const Map& map)
+{
+  std::vector<std::string> items(map.begin(), map.end());
+  std::sort(items.begin(), items.end());
+  return items;
+}
+
+void thenMapContains(const Map& map, std::vector<std::string> expected)
+{
+  std::vector<std::string> items = sortedItems(map);
+  std::sort(expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(map.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(items.begin(), items.end(), expected.begin(), expected.end());
+}
+
+// throws once copiesLeft runs out; a negative budget never runs out
+struct ThrowingCopy
+{
+  static int alive;
+  static int copiesLeft;
+
+  int value;
+
+  ThrowingCopy(int value) : value(value)
+  {
+    ++alive;
+  }
+
+  ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+  {
+    if (copiesLeft-- == 0)
+      throw std::runtime_error("copy failed");
+    ++alive;
+  }
+
+  ThrowingCopy(ThrowingCopy&& other) : value(other.value)
+  {
+    ++alive;
+  }
+
+  ~ThrowingCopy()
+  {
+    --alive;
+  }
+};
+
+int ThrowingCopy::alive = 0;
+int ThrowingCopy::copiesLeft = -1;
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SlotMapTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const Map map;
+
+  BOOST_CHECK(map.isEmpty());
+  BOOST_CHECK(map.begin() == map.end());
+  BOOST_CHECK(!map.contains(Map::Handle()));
+  BOOST_CHECK_THROW(map[Map::Handle()], std::out_of_range);
+  BOOST_CHECK(map.tryGet(Map::Handle(0, 0)) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenInsertingItems_ThenTheyAreReachedByHandles)
+{
+  Map map;
+  Map::Handle lorem = map.insert("Lorem");
+  Map::Handle ipsum = map.emplace(3, 'i');
+
+  BOOST_CHECK(lorem != ipsum);
+  BOOST_CHECK_EQUAL(map[lorem], "Lorem");
+  BOOST_CHECK_EQUAL(map[ipsum], "iii");
+  map[lorem] = "dolor";
+  BOOST_CHECK_EQUAL(*map.tryGet(lorem), "dolor");
+  thenMapContains(map, { "dolor", "iii" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenErasingItem_ThenItsHandleBecomesStale)
+{
+  Map map;
+  Map::Handle lorem = map.insert("Lorem");
+  Map::Handle ipsum = map.insert("ipsum");
+  Map::Handle dolor = map.insert("dolor");
+
+  map.erase(lorem);
+
+  BOOST_CHECK(!map.contains(lorem));
+  BOOST_CHECK(map.tryGet(lorem) == nullptr);
+  BOOST_CHECK_THROW(map[lorem], std::out_of_range);
+  BOOST_CHECK_THROW(map.erase(lorem), std::out_of_range);
+  BOOST_CHECK_EQUAL(map[ipsum], "ipsum");
+  BOOST_CHECK_EQUAL(map[dolor], "dolor");
+  thenMapContains(map, { "ipsum", "dolor" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenErasedItem_WhenItsSlotIsReused_ThenOldHandleDoesNotReachNewItem)
+{
+  Map map;
+  Map::Handle lorem = map.insert("Lorem");
+  map.erase(lorem);
+
+  Map::Handle ipsum = map.insert("ipsum");
+
+  BOOST_CHECK_EQUAL(ipsum.index, lorem.index);
+  BOOST_CHECK(!map.contains(lorem));
+  BOOST_CHECK_EQUAL(map[ipsum], "ipsum");
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenErasingByIterator_ThenItemsStayDense)
+{
+  Map map;
+  map.insert("sit");
+  map.insert("amet");
+  Map::Handle last = map.insert("consectetur");
+
+  map.erase(map.begin());
+
+  BOOST_CHECK_EQUAL(map.getSize(), 2);
+  BOOST_CHECK_EQUAL(*map.begin(), "consectetur");
+  BOOST_CHECK(map.getHandle(map.begin()) == last);
+  BOOST_CHECK_THROW(map.erase(map.end()), std::out_of_range);
+  BOOST_CHECK_THROW(map.getHandle(map.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyInsertsAndErases_WhenCheckingHandles_ThenTheyMatchReference)
+{
+  Map map;
+  std::map<int, std::pair<Map::Handle, std::string>> alive;
+  std::vector<Map::Handle> erased;
+  for (int i = 0; i < 5000; ++i)
+  {
+    std::string item = "item " + std::to_string(i);
+    alive[i] = { map.insert(item), item };
+    if (i % 3 == 2)
+    {
+      auto victim = alive.begin();
+      std::advance(victim, (i * 7919) % alive.size());
+      map.erase(victim->second.first);
+      erased.push_back(victim->second.first);
+      alive.erase(victim);
+    }
+  }
+
+  BOOST_REQUIRE_EQUAL(map.getSize(), alive.size());
+  for (const auto& entry : alive)
+    BOOST_CHECK_EQUAL(map[entry.second.first], entry.second.second);
+  for (const Map::Handle& handle : erased)
+    BOOST_CHECK(!map.contains(handle));
+  for (auto it = map.cbegin(); it != map.cend(); ++it)
+    BOOST_CHECK(&map[map.getHandle(it)] == &*it);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenCleared_ThenAllHandlesBecomeStale)
+{
+  Map map;
+  Map::Handle lorem = map.insert("Lorem");
+  Map::Handle ipsum = map.insert("ipsum");
+
+  map.clear();
+
+  BOOST_CHECK(map.isEmpty());
+  BOOST_CHECK(!map.contains(lorem));
+  BOOST_CHECK(!map.contains(ipsum));
+  map.insert("dolor");
+  thenMapContains(map, { "dolor" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenInsertingCopyOfItsOwnItem_ThenItIsCopiedBeforeGrowing)
+{
+  Map map;
+  Map::Handle first = map.insert(std::string(100, 'a'));
+  for (int i = 1; i < 64; ++i)
+    map.insert("x");
+
+  Map::Handle copy = map.insert(map[first]);
+
+  BOOST_CHECK_EQUAL(map[copy], std::string(100, 'a'));
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenCopied_ThenHandlesWorkForBothAndCopyIsIndependent)
+{
+  Map map;
+  Map::Handle lorem = map.insert("Lorem");
+  Map::Handle ipsum = map.insert("ipsum");
+  map.erase(lorem);
+  Map other(map);
+
+  other[ipsum] = "changed";
+  Map::Handle dolor = other.insert("dolor");
+
+  BOOST_CHECK_EQUAL(map[ipsum], "ipsum");
+  BOOST_CHECK(!map.contains(dolor));
+  BOOST_CHECK(!other.contains(lorem));
+  thenMapContains(other, { "changed", "dolor" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenCopyOfItemThrows_ThenCopiedItemsAreDestroyed)
+{
+  {
+    aisdi::SlotMap<ThrowingCopy> map;
+    for (int i = 0; i < 5; ++i)
+      map.emplace(i);
+    map.erase(map.getHandle(map.begin() + 1));
+
+    ThrowingCopy::copiesLeft = 2;
+    BOOST_CHECK_THROW(aisdi::SlotMap<ThrowingCopy>{ map }, std::runtime_error);
+    ThrowingCopy::copiesLeft = -1;
+
+    BOOST_CHECK_EQUAL(ThrowingCopy::alive, 4);
+  }
+  BOOST_CHECK_EQUAL(ThrowingCopy::alive, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMap_WhenMoved_ThenHandlesMoveWithItems)
+{
+  Map map;
+  Map::Handle lorem = map.insert("Lorem");
+  Map other(std::move(map));
+
+  BOOST_CHECK(map.isEmpty());
+  BOOST_CHECK_EQUAL(other[lorem], "Lorem");
+
+  map = std::move(other);
+  BOOST_CHECK_EQUAL(map[lorem], "Lorem");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
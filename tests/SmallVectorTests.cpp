@@ -0,0 +1,179 @@
+#include <SmallVector.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+template <typename T>
+using LinearCollection = aisdi::SmallVector<T, 4>;
+
+using std::begin;
+using std::end;
+
+namespace
+{
+
+template <typename T>
+void thenCollectionMatches(const LinearCollection<T>& collection, const std::vector<T>& expected)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), begin(expected), end(expected));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SmallVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmptyAndInline)
+{
+  const LinearCollection<int> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.isInline());
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenComparingIteratorTypes_ThenTheyAreThoseOfVector)
+{
+  BOOST_CHECK((std::is_same<LinearCollection<int>::iterator, aisdi::Vector<int>::iterator>::value));
+  BOOST_CHECK((std::is_same<LinearCollection<int>::const_iterator, aisdi::Vector<int>::const_iterator>::value));
+}
+
+BOOST_AUTO_TEST_CASE(GivenSmallCollection_WhenAppendingUpToInlineCapacity_ThenNothingIsAllocated)
+{
+  LinearCollection<std::string> collection;
+
+  for (int i = 0; i < 4; ++i)
+    collection.append(std::to_string(i));
+
+  BOOST_CHECK(collection.isInline());
+  thenCollectionMatches(collection, { "0", "1", "2", "3" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullInlineStorage_WhenAppending_ThenItemsSpillToHeap)
+{
+  LinearCollection<std::string> collection = { "0", "1", "2", "3" };
+
+  collection.append("4");
+
+  BOOST_CHECK(!collection.isInline());
+  thenCollectionMatches(collection, { "0", "1", "2", "3", "4" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenInsertingAndErasing_ThenItemsAreShifted)
+{
+  LinearCollection<int> collection = { 1, 3 };
+
+  collection.prepend(0);
+  collection.insert(collection.begin() + 2, 2);
+  collection.insert(collection.end(), 4);
+  collection.erase(collection.begin() + 1);
+  collection.erase(collection.begin(), collection.begin() + 1);
+
+  thenCollectionMatches(collection, { 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenErasingEmptyRange_ThenNothingHappens)
+{
+  // long enough not to fit in the small string buffer
+  const std::string first(20, '1');
+  const std::string second(20, '2');
+  LinearCollection<std::string> collection = { first, second, first };
+
+  collection.erase(collection.begin(), collection.begin());
+  collection.erase(collection.begin() + 1, collection.begin() + 1);
+
+  thenCollectionMatches(collection, { first, second, first });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenAddingCopiesOfItsOwnItems_ThenTheyAreCopiedBeforeShifting)
+{
+  const std::string first(20, '1');
+  const std::string second(20, '2');
+  LinearCollection<std::string> collection = { first, second };
+
+  collection.prepend(*(collection.cbegin() + 1));
+  collection.insert(collection.cbegin() + 1, *(collection.cbegin() + 2));
+
+  thenCollectionMatches(collection, { second, second, first, second });
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullInlineStorage_WhenAppendingCopyOfItsOwnItem_ThenItIsCopiedBeforeGrowing)
+{
+  const std::string first(20, '1');
+  const std::string second(20, '2');
+  aisdi::SmallVector<std::string, 2> collection = { first, second };
+
+  collection.append(*collection.cbegin());
+
+  BOOST_REQUIRE_EQUAL(collection.getSize(), 3);
+  BOOST_CHECK(!collection.isInline());
+  BOOST_CHECK_EQUAL(*(collection.cbegin() + 2), first);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPopping_ThenEndsAreReturned)
+{
+  LinearCollection<int> collection = { 1, 2, 3 };
+
+  BOOST_CHECK_EQUAL(collection.popFirst(), 1);
+  BOOST_CHECK_EQUAL(collection.popLast(), 3);
+  thenCollectionMatches(collection, { 2 });
+
+  collection.popLast();
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(collection.begin()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenInlineCollection_WhenMoved_ThenItemsAreMovedIntoTheTarget)
+{
+  LinearCollection<std::string> collection = { "Lorem", "ipsum" };
+
+  LinearCollection<std::string> other(std::move(collection));
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(other.isInline());
+  thenCollectionMatches(other, { "Lorem", "ipsum" });
+
+  collection.append("dolor");
+  thenCollectionMatches(collection, { "dolor" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenHeapCollection_WhenMoved_ThenBufferIsTakenOver)
+{
+  LinearCollection<int> collection = { 1, 2, 3, 4, 5, 6 };
+  const int *first = &*collection.begin();
+
+  LinearCollection<int> other;
+  other = std::move(collection);
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.isInline());
+  BOOST_CHECK_EQUAL(&*other.begin(), first);
+  thenCollectionMatches(other, { 1, 2, 3, 4, 5, 6 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopied_ThenCopyIsIndependent)
+{
+  LinearCollection<std::string> small = { "Lorem" };
+  LinearCollection<std::string> large = { "a", "b", "c", "d", "e" };
+
+  LinearCollection<std::string> smallCopy(small);
+  LinearCollection<std::string> largeCopy(large);
+  small.append("ipsum");
+  large = small;
+
+  thenCollectionMatches(smallCopy, { "Lorem" });
+  thenCollectionMatches(largeCopy, { "a", "b", "c", "d", "e" });
+  thenCollectionMatches(large, { "Lorem", "ipsum" });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
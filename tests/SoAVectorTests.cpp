@@ -0,0 +1,200 @@
+#include <SoAVector.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+// throws once copiesLeft runs out; a negative budget never runs out
+struct ThrowingCopy
+{
+  static int alive;
+  static int copiesLeft;
+
+  int value;
+
+  ThrowingCopy(int value) : value(value)
+  {
+    ++alive;
+  }
+
+  ThrowingCopy(const ThrowingCopy& other) : value(other.value)
+  {
+    if (copiesLeft-- == 0)
+      throw std::runtime_error("copy failed");
+    ++alive;
+  }
+
+  ThrowingCopy(ThrowingCopy&& other) : value(other.value)
+  {
+    ++alive;
+  }
+
+  ~ThrowingCopy()
+  {
+    --alive;
+  }
+};
+
+int ThrowingCopy::alive = 0;
+int ThrowingCopy::copiesLeft = -1;
+
+} // namespace
+
+using Records = aisdi::SoAVector<std::uint32_t, std::string, double>;
+
+BOOST_AUTO_TEST_SUITE(SoAVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const Records collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenAppendingRecords_ThenFieldsAreReadable)
+{
+  Records collection;
+
+  collection.append(1, "Lorem", 0.5);
+  collection.append(2, "ipsum", 1.5);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 2);
+  BOOST_CHECK_EQUAL(std::get<0>(collection[0]), 1u);
+  BOOST_CHECK_EQUAL(std::get<1>(collection[1]), "ipsum");
+  BOOST_CHECK_EQUAL(std::get<2>(collection[1]), 1.5);
+  BOOST_CHECK_THROW(collection[2], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenGettingColumn_ThenFieldIsContiguous)
+{
+  Records collection;
+  for (std::uint32_t i = 0; i < 1000; ++i)
+    collection.append(i, std::to_string(i), i * 0.5);
+
+  const std::uint32_t *ids = collection.getColumn<0>();
+  const double *weights = collection.getColumn<2>();
+  std::uint64_t idSum = 0;
+  double weightSum = 0;
+  for (std::size_t i = 0; i < collection.getSize(); ++i)
+  {
+    idSum += ids[i];
+    weightSum += weights[i];
+  }
+
+  BOOST_CHECK_EQUAL(idSum, 999u * 1000u / 2);
+  BOOST_CHECK_EQUAL(weightSum, 999.0 * 1000.0 / 4);
+  BOOST_CHECK_EQUAL(collection.getColumn<1>()[999], "999");
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenModifiedThroughProxy_ThenColumnsChange)
+{
+  Records collection;
+  collection.append(1, "Lorem", 0.5);
+  collection.append(2, "ipsum", 1.5);
+
+  for (auto record : collection)
+  {
+    auto &[id, name, weight] = record;
+    id *= 10;
+    name += "!";
+    weight = 0;
+  }
+  *(collection.begin() + 1) = std::make_tuple(7u, std::string("dolor"), 2.5);
+
+  BOOST_CHECK_EQUAL(collection.getColumn<0>()[0], 10u);
+  BOOST_CHECK_EQUAL(collection.getColumn<1>()[0], "Lorem!");
+  BOOST_CHECK_EQUAL(collection.getColumn<2>()[0], 0.0);
+  BOOST_CHECK_EQUAL(collection.getColumn<0>()[1], 7u);
+  BOOST_CHECK_EQUAL(collection.getColumn<1>()[1], "dolor");
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPoppingLast_ThenRecordIsReturned)
+{
+  Records collection;
+  collection.append(1, "Lorem", 0.5);
+
+  BOOST_CHECK(collection.popLast() == std::make_tuple(1u, std::string("Lorem"), 0.5));
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenErasing_ThenEveryColumnIsShifted)
+{
+  Records collection;
+  for (std::uint32_t i = 0; i < 6; ++i)
+    collection.append(i, std::to_string(i), i);
+
+  collection.erase(collection.begin() + 1);
+  collection.erase(collection.begin() + 2, collection.begin() + 4);
+
+  BOOST_REQUIRE_EQUAL(collection.getSize(), 3);
+  BOOST_CHECK(collection[0] == std::make_tuple(0u, std::string("0"), 0.0));
+  BOOST_CHECK(collection[1] == std::make_tuple(2u, std::string("2"), 2.0));
+  BOOST_CHECK(collection[2] == std::make_tuple(5u, std::string("5"), 5.0));
+  BOOST_CHECK_THROW(collection.erase(collection.end()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenErasingEmptyRange_ThenNothingHappens)
+{
+  // long enough not to fit in the small string buffer
+  const std::string first(20, '1');
+  const std::string second(20, '2');
+  Records collection;
+  collection.append(1, first, 0.5);
+  collection.append(2, second, 1.5);
+
+  collection.erase(collection.begin(), collection.begin());
+  collection.erase(collection.begin() + 1, collection.begin() + 1);
+
+  BOOST_REQUIRE_EQUAL(collection.getSize(), 2);
+  BOOST_CHECK(collection[0] == std::make_tuple(1u, first, 0.5));
+  BOOST_CHECK(collection[1] == std::make_tuple(2u, second, 1.5));
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenAppendedFieldCopyThrows_ThenBuiltFieldsAreDestroyed)
+{
+  {
+    aisdi::SoAVector<ThrowingCopy, std::string, ThrowingCopy> collection;
+    collection.append(ThrowingCopy(1), "Lorem", ThrowingCopy(2));
+    BOOST_REQUIRE_EQUAL(ThrowingCopy::alive, 2);
+
+    const ThrowingCopy first(3);
+    const ThrowingCopy last(4);
+    ThrowingCopy::copiesLeft = 1;
+    BOOST_CHECK_THROW(collection.append(first, std::string(20, 'x'), last), std::runtime_error);
+    ThrowingCopy::copiesLeft = -1;
+
+    BOOST_CHECK_EQUAL(collection.getSize(), 1);
+    BOOST_CHECK_EQUAL(ThrowingCopy::alive, 4);
+    BOOST_CHECK_EQUAL(std::get<0>(collection[0]).value, 1);
+  }
+  BOOST_CHECK_EQUAL(ThrowingCopy::alive, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenCopiedAndMoved_ThenRecordsAreKept)
+{
+  Records collection;
+  collection.append(1, "Lorem", 0.5);
+
+  Records copy(collection);
+  std::get<1>(copy[0]) = "ipsum";
+  Records moved(std::move(collection));
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(std::get<1>(moved[0]), "Lorem");
+  BOOST_CHECK_EQUAL(std::get<1>(copy[0]), "ipsum");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
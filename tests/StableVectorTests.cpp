@@ -0,0 +1,125 @@
+#include <StableVector.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+template <typename T>
+using StableCollection = aisdi::StableVector<T>;
+
+using std::begin;
+using std::end;
+
+BOOST_AUTO_TEST_SUITE(StableVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  StableCollection<int> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getSize(), 0);
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithInitializerList_ThenItemsAreIndexed)
+{
+  const StableCollection<std::string> collection = { "Lorem", "ipsum", "dolor" };
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 3);
+  BOOST_CHECK_EQUAL(collection[0], "Lorem");
+  BOOST_CHECK_EQUAL(collection[2], "dolor");
+  BOOST_CHECK_THROW(collection[3], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenGrowingOverManyChunks_ThenReferencesStayValid)
+{
+  StableCollection<int> collection;
+  collection.append(0);
+  int &first = collection[0];
+  auto firstIt = collection.begin();
+
+  for (int i = 1; i < 100000; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_EQUAL(&first, &collection[0]);
+  BOOST_CHECK(firstIt == collection.begin());
+  first = 42;
+  BOOST_CHECK_EQUAL(*firstIt, 42);
+  for (int i = 1; i < 100000; ++i)
+    BOOST_CHECK_EQUAL(collection[i], i);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPoppingLast_ThenItemsComeBackInReverseOrder)
+{
+  StableCollection<int> collection;
+  for (int i = 0; i < 1000; ++i)
+    collection.append(i);
+
+  for (int i = 999; i >= 0; --i)
+    BOOST_CHECK_EQUAL(collection.popLast(), i);
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenPoppedCollection_WhenAppendingAgain_ThenChunksAreReused)
+{
+  StableCollection<int> collection = { 1, 2 };
+  const int *second = &collection[1];
+  collection.popLast();
+
+  collection.append(3);
+
+  BOOST_CHECK_EQUAL(second, &collection[1]);
+  BOOST_CHECK_EQUAL(collection[1], 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenIterating_ThenItemsAreVisitedInOrder)
+{
+  StableCollection<int> collection = { 1, 2, 3, 4 };
+
+  for (auto it = collection.begin(); it != collection.end(); ++it)
+    *it *= 10;
+
+  const int expected[] = { 10, 20, 30, 40 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(collection.cbegin(), collection.cend(), begin(expected), end(expected));
+  BOOST_CHECK_EQUAL(*(collection.end() - 1), 40);
+  BOOST_CHECK_EQUAL(*(collection.begin() + 2), 30);
+  BOOST_CHECK_THROW(collection.begin() + 5, std::out_of_range);
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenCopied_ThenCopyIsIndependent)
+{
+  StableCollection<std::string> collection = { "Lorem", "ipsum" };
+  StableCollection<std::string> copy(collection);
+
+  copy[0] = "dolor";
+
+  BOOST_CHECK_EQUAL(collection[0], "Lorem");
+  BOOST_CHECK_EQUAL(copy[0], "dolor");
+  BOOST_CHECK_EQUAL(copy.getSize(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenMoved_ThenItemsDoNotMove)
+{
+  StableCollection<std::string> collection = { "Lorem", "ipsum" };
+  const std::string *first = &collection[0];
+
+  StableCollection<std::string> other(std::move(collection));
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(&other[0], first);
+
+  collection = std::move(other);
+  BOOST_CHECK_EQUAL(&collection[0], first);
+  BOOST_CHECK_EQUAL(collection.getSize(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+#include <StaticVector.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+template <typename T>
+using LinearCollection = aisdi::StaticVector<T, 8>;
+
+using std::begin;
+using std::end;
+
+namespace
+{
+
+template <typename T>
+void thenCollectionMatches(const LinearCollection<T>& collection, const std::vector<T>& expected)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), begin(expected), end(expected));
+}
+
+constexpr LinearCollection<int> makeSquares()
+{
+  LinearCollection<int> squares;
+  for (int i = 0; i < 6; ++i)
+    squares.append(i * i);
+
+  squares.erase(squares.cbegin() + 1);
+  squares.insert(squares.cbegin(), -1);
+  squares.popLast();
+  return squares;
+}
+
+constexpr int sum(const LinearCollection<int>& collection)
+{
+  int result = 0;
+  for (auto item : collection)
+    result += item;
+  return result;
+}
+
+constexpr LinearCollection<int> squares = makeSquares();
+
+static_assert(squares.getSize() == 5, "StaticVector has to be usable in constant expressions");
+static_assert(squares[0] == -1 && squares[1] == 0 && squares[2] == 4, "StaticVector has to be usable in constant expressions");
+static_assert(sum(squares) == 28, "Vector iterators have to be usable in constant expressions");
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(StaticVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const LinearCollection<int> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getCapacity(), 8);
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenComparingIteratorTypes_ThenTheyAreThoseOfVector)
+{
+  BOOST_CHECK((std::is_same<LinearCollection<int>::iterator, aisdi::Vector<int>::iterator>::value));
+  BOOST_CHECK((std::is_same<LinearCollection<int>::const_iterator, aisdi::Vector<int>::const_iterator>::value));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCompileTimeTable_WhenReadAtRunTime_ThenItemsAreThere)
+{
+  thenCollectionMatches(squares, { -1, 0, 4, 9, 16 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenFullCollection_WhenAdding_ThenOperationThrows)
+{
+  LinearCollection<int> collection = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+  BOOST_CHECK_THROW(collection.append(9), std::length_error);
+  BOOST_CHECK_THROW(collection.prepend(0), std::length_error);
+  BOOST_CHECK_THROW(collection.insert(collection.begin() + 1, 0), std::length_error);
+  BOOST_CHECK_THROW(LinearCollection<int>({ 1, 2, 3, 4, 5, 6, 7, 8, 9 }), std::length_error);
+  BOOST_CHECK_EQUAL(collection.getSize(), 8);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenInsertingAndErasing_ThenItemsAreShifted)
+{
+  LinearCollection<std::string> collection = { "b", "d" };
+
+  collection.prepend("a");
+  collection.insert(collection.begin() + 2, "c");
+  collection.insert(collection.end(), "e");
+  collection.erase(collection.begin() + 1, collection.begin() + 3);
+
+  thenCollectionMatches(collection, { "a", "d", "e" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenErasingEmptyRange_ThenNothingHappens)
+{
+  // long enough not to fit in the small string buffer
+  const std::string first(20, '1');
+  const std::string second(20, '2');
+  LinearCollection<std::string> collection = { first, second, first };
+
+  collection.erase(collection.begin(), collection.begin());
+  collection.erase(collection.begin() + 1, collection.begin() + 1);
+
+  thenCollectionMatches(collection, { first, second, first });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPopping_ThenEndsAreReturned)
+{
+  LinearCollection<std::string> collection = { "Lorem", "ipsum", "dolor" };
+
+  BOOST_CHECK_EQUAL(collection.popFirst(), "Lorem");
+  BOOST_CHECK_EQUAL(collection.popLast(), "dolor");
+  thenCollectionMatches(collection, { "ipsum" });
+
+  collection.erase(collection.begin());
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(collection.begin()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenModifiedThroughIterator_ThenItemChanges)
+{
+  LinearCollection<int> collection = { 1, 2, 3 };
+
+  for (auto it = collection.begin(); it != collection.end(); ++it)
+    *it *= 2;
+
+  thenCollectionMatches(collection, { 2, 4, 6 });
+  BOOST_CHECK_THROW(collection[3], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
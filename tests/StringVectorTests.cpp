@@ -0,0 +1,179 @@
+#include <StringVector.h>
+
+#include <cstddef>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+namespace
+{
+
+void thenCollectionContainsValues(const aisdi::StringVector& collection,
+                                  const std::vector<std::string>& expected)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    BOOST_CHECK_EQUAL(collection[i], expected[i]);
+
+  std::vector<std::string> iterated(collection.begin(), collection.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(iterated.begin(), iterated.end(), expected.begin(), expected.end());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(StringVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const aisdi::StringVector collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getCharacterCount(), 0);
+  BOOST_CHECK(collection.begin() == collection.end());
+  BOOST_CHECK_THROW(collection[0], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPoppingLast_ThenExceptionIsThrown)
+{
+  aisdi::StringVector collection;
+
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAppendingStrings_ThenTheyAreReadBackAsViews)
+{
+  aisdi::StringVector collection;
+  collection.append("Lorem");
+  collection.append("");
+  collection.append(std::string("ipsum"));
+
+  thenCollectionContainsValues(collection, { "Lorem", "", "ipsum" });
+  BOOST_CHECK_EQUAL(collection.getCharacterCount(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAppendingItsOwnItem_ThenItIsCopiedBeforeGrowing)
+{
+  aisdi::StringVector collection;
+  collection.append(std::string(1000, 'a'));
+  for (int i = 0; i < 4; ++i)
+    collection.append(collection[collection.getSize() - 1]);
+
+  thenCollectionContainsValues(collection, std::vector<std::string>(5, std::string(1000, 'a')));
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAppendingBatchOfItsOwnItems_ThenTheyAreCopiedBeforeGrowing)
+{
+  aisdi::StringVector collection;
+  collection.append(std::string(600, 'a'));
+  collection.append(std::string(400, 'b'));
+  std::vector<std::string_view> batch = { collection[1], collection[0], collection[1] };
+
+  collection.appendBatch(batch.begin(), batch.end());
+
+  thenCollectionContainsValues(collection, { std::string(600, 'a'), std::string(400, 'b'),
+                                             std::string(400, 'b'), std::string(600, 'a'),
+                                             std::string(400, 'b') });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollectionWithItems_WhenPoppingLast_ThenStringIsReturnedAndArenaShrinks)
+{
+  aisdi::StringVector collection = { "dolor", "sit", "amet" };
+
+  BOOST_CHECK_EQUAL(collection.popLast(), "amet");
+  BOOST_CHECK_EQUAL(collection.getCharacterCount(), 8);
+  collection.append("consectetur");
+
+  thenCollectionContainsValues(collection, { "dolor", "sit", "consectetur" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenManyStrings_WhenAppended_ThenAllAreKept)
+{
+  aisdi::StringVector collection;
+  std::vector<std::string> expected;
+  for (int i = 0; i < 10000; ++i)
+  {
+    expected.push_back(std::to_string(i * 7919));
+    collection.append(expected.back());
+  }
+
+  thenCollectionContainsValues(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenStringRange_WhenAppendedAsBatch_ThenItemsFollowExistingOnes)
+{
+  aisdi::StringVector collection = { "Lorem" };
+  const std::vector<std::string> batch = { "ipsum", "dolor", "", "sit" };
+
+  collection.appendBatch(batch.begin(), batch.end());
+
+  thenCollectionContainsValues(collection, { "Lorem", "ipsum", "dolor", "", "sit" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenInputStream_WhenAppendedAsBatch_ThenEveryWordIsAppended)
+{
+  aisdi::StringVector collection;
+  std::istringstream stream("Praesent posuere tortor quis");
+
+  collection.appendBatch(std::istream_iterator<std::string>(stream), std::istream_iterator<std::string>());
+
+  thenCollectionContainsValues(collection, { "Praesent", "posuere", "tortor", "quis" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopied_ThenCopyIsIndependent)
+{
+  aisdi::StringVector collection = { "iaculis", "dignissim" };
+  aisdi::StringVector other(collection);
+
+  other.append("Vestibulum");
+  collection.popLast();
+
+  thenCollectionContainsValues(collection, { "iaculis" });
+  thenCollectionContainsValues(other, { "iaculis", "dignissim", "Vestibulum" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCopyAssigned_ThenItemsAreReplaced)
+{
+  const aisdi::StringVector collection = { "nec", "tortor" };
+  aisdi::StringVector other = { "malesuada", "semper", "enim" };
+
+  other = collection;
+
+  thenCollectionContainsValues(other, { "nec", "tortor" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenMoved_ThenItemsAreTransferred)
+{
+  aisdi::StringVector collection = { "faucibus", "lectus" };
+  aisdi::StringVector other(std::move(collection));
+
+  thenCollectionContainsValues(other, { "faucibus", "lectus" });
+  BOOST_CHECK(collection.isEmpty());
+
+  collection = std::move(other);
+  thenCollectionContainsValues(collection, { "faucibus", "lectus" });
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenIteratingBackwards_ThenItemsAreVisitedInReverse)
+{
+  const aisdi::StringVector collection = { "Morbi", "urna", "risus" };
+
+  auto it = collection.end();
+  BOOST_CHECK_EQUAL(*--it, "risus");
+  BOOST_CHECK_EQUAL(*--it, "urna");
+  BOOST_CHECK_EQUAL(*--it, "Morbi");
+  BOOST_CHECK_THROW(--it, std::out_of_range);
+  BOOST_CHECK_EQUAL(*(collection.begin() + 2), "risus");
+  BOOST_CHECK_THROW(*collection.end(), std::out_of_range);
+  BOOST_CHECK_THROW(collection.end() + 1, std::out_of_range);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
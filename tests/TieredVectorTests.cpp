@@ -0,0 +1,214 @@
+#include <TieredVector.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+template <typename T>
+using LinearCollection = aisdi::TieredVector<T>;
+
+using std::begin;
+using std::end;
+
+namespace
+{
+
+template <typename T>
+void thenCollectionMatches(const LinearCollection<T>& collection, const std::vector<T>& expected)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), expected.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(begin(collection), end(collection), begin(expected), end(expected));
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    BOOST_REQUIRE_EQUAL(collection[i], expected[i]);
+}
+
+// copyable, yet never assigned to by the collection
+struct NotAssignable
+{
+  int value;
+
+  NotAssignable(int value) : value(value) {}
+  NotAssignable(const NotAssignable&) = default;
+  NotAssignable& operator=(const NotAssignable&) = delete;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(TieredVectorTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  const LinearCollection<int> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK(collection.begin() == collection.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithInitializerList_ThenItemsAreIndexed)
+{
+  const LinearCollection<std::string> collection = { "Lorem", "ipsum", "dolor" };
+
+  thenCollectionMatches(collection, { "Lorem", "ipsum", "dolor" });
+  BOOST_CHECK_THROW(collection[3], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPrependingItems_ThenTheyComeFirst)
+{
+  LinearCollection<int> collection;
+  std::vector<int> expected;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    collection.prepend(i);
+    expected.insert(expected.begin(), i);
+  }
+
+  thenCollectionMatches(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenInsertingInTheMiddle_ThenItemsAreShifted)
+{
+  LinearCollection<int> collection = { 1, 2, 4 };
+
+  collection.insert(collection.begin() + 2, 3);
+
+  thenCollectionMatches(collection, { 1, 2, 3, 4 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenErasingRange_ThenRemainingItemsAreKept)
+{
+  LinearCollection<int> collection;
+  std::vector<int> expected;
+  for (int i = 0; i < 500; ++i)
+  {
+    collection.append(i);
+    expected.push_back(i);
+  }
+
+  collection.erase(collection.begin() + 100, collection.begin() + 350);
+  expected.erase(expected.begin() + 100, expected.begin() + 350);
+
+  thenCollectionMatches(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomRanges_WhenErasing_ThenCollectionMatchesReference)
+{
+  std::size_t seed = 54321;
+  auto random = [&seed]() {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<std::size_t>(seed >> 33);
+  };
+
+  for (int round = 0; round < 20; ++round)
+  {
+    LinearCollection<std::string> collection;
+    std::vector<std::string> expected;
+    for (std::size_t i = 0, count = random() % 3000 + 1; i < count; ++i)
+    {
+      collection.append(std::to_string(i));
+      expected.push_back(std::to_string(i));
+    }
+
+    while (!expected.empty())
+    {
+      std::size_t first = random() % expected.size();
+      std::size_t length = random() % 3 == 0 ? random() % (expected.size() - first + 1) : random() % 40;
+      length = std::min(length, expected.size() - first);
+      collection.erase(collection.cbegin() + first, collection.cbegin() + first + length);
+      expected.erase(expected.begin() + first, expected.begin() + first + length);
+      thenCollectionMatches(collection, expected);
+
+      if (length == 0)
+      {
+        collection.erase(collection.cbegin() + first);
+        expected.erase(expected.begin() + first);
+      }
+    }
+    BOOST_CHECK(collection.isEmpty());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GivenNotAssignableItems_WhenErasingRange_ThenTheyAreRelocated)
+{
+  LinearCollection<NotAssignable> collection;
+  for (int i = 0; i < 100; ++i)
+    collection.append(i);
+
+  collection.erase(collection.begin() + 10, collection.begin() + 60);
+
+  BOOST_REQUIRE_EQUAL(collection.getSize(), 50);
+  BOOST_CHECK_EQUAL(collection[9].value, 9);
+  BOOST_CHECK_EQUAL(collection[10].value, 60);
+  BOOST_CHECK_EQUAL(collection[49].value, 99);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPoppingOrErasing_ThenOperationThrows)
+{
+  LinearCollection<int> collection;
+
+  BOOST_CHECK_THROW(collection.popFirst(), std::logic_error);
+  BOOST_CHECK_THROW(collection.popLast(), std::logic_error);
+  BOOST_CHECK_THROW(collection.erase(collection.begin()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRandomEdits_WhenCollectionGrowsAndShrinks_ThenItMatchesReference)
+{
+  LinearCollection<std::string> collection;
+  std::vector<std::string> expected;
+  std::size_t seed = 12345;
+  auto random = [&seed]() {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<std::size_t>(seed >> 33);
+  };
+
+  for (int round = 0; round < 20000; ++round)
+  {
+    bool grow = round < 12000 ? random() % 4 != 0 : random() % 4 == 0;
+    if (grow || expected.empty())
+    {
+      std::size_t position = random() % (expected.size() + 1);
+      collection.insert(collection.cbegin() + position, std::to_string(round));
+      expected.insert(expected.begin() + position, std::to_string(round));
+    }
+    else
+    {
+      std::size_t position = random() % expected.size();
+      collection.erase(collection.cbegin() + position);
+      expected.erase(expected.begin() + position);
+    }
+  }
+
+  thenCollectionMatches(collection, expected);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPoppingFirstAndLast_ThenEndsAreReturned)
+{
+  LinearCollection<int> collection = { 1, 2, 3 };
+
+  BOOST_CHECK_EQUAL(collection.popFirst(), 1);
+  BOOST_CHECK_EQUAL(collection.popLast(), 3);
+  thenCollectionMatches(collection, { 2 });
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenCopiedAndMoved_ThenItemsAreKept)
+{
+  LinearCollection<std::string> collection = { "Lorem", "ipsum" };
+
+  LinearCollection<std::string> copy(collection);
+  copy[0] = "dolor";
+  LinearCollection<std::string> moved(std::move(collection));
+
+  BOOST_CHECK(collection.isEmpty());
+  thenCollectionMatches(moved, { "Lorem", "ipsum" });
+  thenCollectionMatches(copy, { "dolor", "ipsum" });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
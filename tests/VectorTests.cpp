@@ -1,5 +1,6 @@
 #include <Vector.h>
 
+#include <algorithm>
 #include <initializer_list>
 #include <complex>
 #include <cstdint>
@@ -679,6 +680,20 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenInsertingInMiddle_Then
   thenCollectionContainsValues(collection, { 11, 42, 12, 13 });
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenFullCollection_WhenInsertingInMiddle_ThenItemInserted,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection(3);
+  collection.append(11);
+  collection.append(12);
+  collection.append(13);
+
+  collection.insert(++begin(collection), 42);
+
+  thenCollectionContainsValues(collection, { 11, 42, 12, 13 });
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenInserting_ThenSizeIsUpdated,
                               T,
                               TestedTypes)
@@ -931,6 +946,216 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GivenNonEmptyCollection_WhenErasingRange_ThenSizeI
   BOOST_CHECK_EQUAL(collection.getSize(), 2);
 }
 
+template <typename T>
+void thenCollectionContainsRange(const LinearCollection<T>& collection, int first, int last)
+{
+  BOOST_REQUIRE_EQUAL(collection.getSize(), static_cast<std::size_t>(last - first));
+  auto it = collection.cbegin();
+  for (int i = first; i < last; ++i, ++it)
+    BOOST_CHECK_EQUAL(*it, T(i));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIncrementalGrowth_WhenAppendingManyItems_ThenAllItemsAreKept,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.setIncrementalGrowth(true);
+
+  for (int i = 0; i < 1000; ++i)
+    collection.append(i);
+
+  BOOST_CHECK(collection.hasIncrementalGrowth());
+  thenCollectionContainsRange(collection, 0, 1000);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIncrementalGrowth_WhenPoppingDuringMigration_ThenItemsAreKept,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.setIncrementalGrowth(true);
+  for (int i = 0; i < 60; ++i)
+    collection.append(i);
+
+  for (int i = 0; i < 20; ++i)
+    collection.popLast();
+  for (int i = 40; i < 200; ++i)
+    collection.append(i);
+
+  thenCollectionContainsRange(collection, 0, 200);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIncrementalGrowth_WhenModifyingDuringMigration_ThenChangeIsKept,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.setIncrementalGrowth(true);
+  for (int i = 1; i < 60; ++i)
+    collection.append(i);
+
+  collection.prepend(0);
+  *(begin(collection) + 10) = T(-10);
+  for (int i = 60; i < 200; ++i)
+    collection.append(i);
+  *(begin(collection) + 10) = T(10);
+
+  thenCollectionContainsRange(collection, 0, 200);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIncrementalGrowth_WhenReadingBetweenAppends_ThenEveryAppendMovesFewItems)
+{
+  LinearCollection<OperationCountingObject> collection;
+  collection.setIncrementalGrowth(true);
+
+  std::size_t mostItemsMoved = 0;
+  for (int i = 0; i < 5000; ++i)
+  {
+    std::size_t before = OperationCountingObject::copiedObjectsCount() + OperationCountingObject::movedObjectsCount();
+    collection.append(i);
+    std::size_t after = OperationCountingObject::copiedObjectsCount() + OperationCountingObject::movedObjectsCount();
+    mostItemsMoved = std::max(mostItemsMoved, after - before);
+
+    BOOST_REQUIRE_EQUAL(collection[i / 2], i / 2);
+    collection[i / 3] = i / 3;
+  }
+
+  // the appended temporary is moved in as well
+  BOOST_CHECK_LE(mostItemsMoved, INCREMENTAL_GROWTH_STEP + 1);
+  BOOST_CHECK_EQUAL(OperationCountingObject::copiedObjectsCount(), 0);
+  thenCollectionContainsRange(collection, 0, 5000);
+}
+
+BOOST_AUTO_TEST_CASE(GivenIncrementalGrowth_WhenIteratingDuringMigration_ThenNothingIsMoved)
+{
+  LinearCollection<OperationCountingObject> collection;
+  collection.setIncrementalGrowth(true);
+  for (int i = 0; i < 70; ++i)
+    collection.append(i);
+  const LinearCollection<OperationCountingObject>& constCollection = collection;
+
+  std::size_t movedBefore = OperationCountingObject::movedObjectsCount();
+  thenCollectionContainsRange(constCollection, 0, 70);
+  int expected = 0;
+  for (auto it = collection.begin(); it != collection.end(); ++it, ++expected)
+    BOOST_REQUIRE_EQUAL(*it, expected);
+  BOOST_CHECK_EQUAL(OperationCountingObject::movedObjectsCount() - movedBefore, 0);
+
+  expected = 1;
+  for (auto it = collection.begin(); it != collection.end(); ++it, ++expected)
+    *it = OperationCountingObject(expected);
+  for (int i = 70; i < 200; ++i)
+    collection.append(i + 1);
+  thenCollectionContainsRange(constCollection, 1, 201);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIncrementalGrowth_WhenWritingThroughReferenceBeforeGrowth_ThenChangeIsKept,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.setIncrementalGrowth(true);
+  for (int i = 0; i < 48; ++i)
+    collection.append(i);
+
+  T& first = collection[0];
+  for (int i = 48; i < 60; ++i)
+    collection.append(i);
+  first = T(-1);
+  for (int i = 60; i < 200; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_EQUAL(collection[0], T(-1));
+  collection[0] = T(0);
+  thenCollectionContainsRange(collection, 0, 200);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIncrementalGrowth_WhenCopyingDuringMigration_ThenBothCollectionsAreEqual,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.setIncrementalGrowth(true);
+  for (int i = 0; i < 70; ++i)
+    collection.append(i);
+
+  LinearCollection<T> other(collection);
+  const LinearCollection<T>& constCollection = collection;
+  other.append(70);
+
+  BOOST_CHECK(other.hasIncrementalGrowth());
+  thenCollectionContainsRange(constCollection, 0, 70);
+  thenCollectionContainsRange(other, 0, 71);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIncrementalGrowth_WhenInsertingIntoFullBufferAndDuringMigration_ThenItemsAreInserted,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+  collection.setIncrementalGrowth(true);
+  for (int i = 0; i < 64; ++i)
+    if (i != 10)
+      collection.append(i);
+  collection.append(100);
+
+  collection.insert(begin(collection) + 10, T(10));
+  BOOST_REQUIRE_EQUAL(collection.popLast(), T(100));
+  for (int i = 64; i < 140; ++i)
+    if (i != 120)
+      collection.append(i);
+
+  collection.insert(begin(collection) + 120, T(120));
+  thenCollectionContainsRange(collection, 0, 140);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenIncrementalGrowth_WhenCollectionIsDestroyed_ThenEveryObjectIsDestroyed,
+                              T,
+                              TestedTypes)
+{
+  {
+    LinearCollection<T> collection;
+    collection.setIncrementalGrowth(true);
+    for (int i = 0; i < 300; ++i)
+      collection.append(i);
+
+    LinearCollection<T> other(std::move(collection));
+    other.append(300);
+  }
+
+  thenDestroyedObjectsCountWas<T>(OperationCountingObject::constructedObjectsCount());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenCollection_WhenAccessingByIndex_ThenItemIsReturned,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection = { 1, 2, 3 };
+  const LinearCollection<T>& constCollection = collection;
+
+  collection[1] = T(20);
+
+  BOOST_CHECK_EQUAL(constCollection[1], T(20));
+  BOOST_CHECK_EQUAL(constCollection[2], T(3));
+  BOOST_CHECK_THROW(collection[3], std::out_of_range);
+  BOOST_CHECK_THROW(constCollection[3], std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(GivenTemporaryItem_WhenAppendingAndPoppingLast_ThenItIsMovedNotCopied,
+                              T,
+                              TestedTypes)
+{
+  LinearCollection<T> collection;
+
+  collection.append(T(7));
+  T item = collection.popLast();
+
+  BOOST_CHECK_EQUAL(item, T(7));
+  thenCopiedObjectsCountWas<T>(0);
+  thenMovedObjectsCountWas<T>(2);
+}
+
 // ConstIterator is tested via Iterator methods.
 // If Iterator methods are to be changed, then new ConstIterator tests are required.
 
@@ -0,0 +1,145 @@
+#include <WorkStealingDeque.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/test_tools.hpp>
+
+template <typename T>
+using ConcurrentCollection = aisdi::WorkStealingDeque<T>;
+
+BOOST_AUTO_TEST_SUITE(WorkStealingDequeTests)
+
+// TESTS
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenCreatedWithDefaultConstructor_ThenItIsEmpty)
+{
+  ConcurrentCollection<int> collection;
+
+  BOOST_CHECK(collection.isEmpty());
+  BOOST_CHECK_EQUAL(collection.getSize(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenEmptyCollection_WhenPoppingOrStealing_ThenOperationFails)
+{
+  ConcurrentCollection<int> collection;
+  int item = 7;
+
+  BOOST_CHECK(!collection.tryPopLast(item));
+  BOOST_CHECK(!collection.trySteal(item));
+  BOOST_CHECK_EQUAL(item, 7);
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenPoppingLast_ThenItemsAreReturnedInLifoOrder)
+{
+  ConcurrentCollection<int> collection;
+  collection.append(1);
+  collection.append(2);
+  collection.append(3);
+
+  int item;
+  BOOST_CHECK(collection.tryPopLast(item));
+  BOOST_CHECK_EQUAL(item, 3);
+  BOOST_CHECK(collection.tryPopLast(item));
+  BOOST_CHECK_EQUAL(item, 2);
+  BOOST_CHECK_EQUAL(collection.getSize(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNonEmptyCollection_WhenStealing_ThenOldestItemIsReturned)
+{
+  ConcurrentCollection<int> collection;
+  collection.append(1);
+  collection.append(2);
+  collection.append(3);
+
+  int item;
+  BOOST_CHECK(collection.trySteal(item));
+  BOOST_CHECK_EQUAL(item, 1);
+  BOOST_CHECK(collection.tryPopLast(item));
+  BOOST_CHECK_EQUAL(item, 3);
+  BOOST_CHECK(collection.trySteal(item));
+  BOOST_CHECK_EQUAL(item, 2);
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenAppendingBeyondCapacity_ThenItGrowsAndKeepsItems)
+{
+  ConcurrentCollection<int> collection(2);
+  int item;
+  collection.append(-1);
+  collection.trySteal(item);
+
+  for (int i = 0; i < 1000; ++i)
+    collection.append(i);
+
+  BOOST_CHECK_EQUAL(collection.getSize(), 1000);
+  for (int i = 0; i < 500; ++i)
+  {
+    BOOST_CHECK(collection.trySteal(item));
+    BOOST_CHECK_EQUAL(item, i);
+  }
+  for (int i = 999; i >= 500; --i)
+  {
+    BOOST_CHECK(collection.tryPopLast(item));
+    BOOST_CHECK_EQUAL(item, i);
+  }
+  BOOST_CHECK(collection.isEmpty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenOwnerAndThieves_WhenRunningConcurrently_ThenEveryItemIsTakenOnce)
+{
+  const std::size_t thiefCount = 3;
+  const std::uint64_t itemCount = 100000;
+  ConcurrentCollection<std::uint64_t> collection(4);
+  std::atomic<std::uint64_t> takenCount(0);
+  std::atomic<std::uint64_t> takenSum(0);
+  std::vector<std::thread> thieves;
+
+  for (std::size_t t = 0; t < thiefCount; ++t)
+  {
+    thieves.emplace_back([&collection, &takenCount, &takenSum, itemCount]() {
+      std::uint64_t item;
+      while (takenCount.load() < itemCount)
+      {
+        if (collection.trySteal(item))
+        {
+          takenSum += item;
+          ++takenCount;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::uint64_t item;
+  for (std::uint64_t i = 1; i <= itemCount; ++i)
+  {
+    collection.append(i);
+    if (i % 3 == 0 && collection.tryPopLast(item))
+    {
+      takenSum += item;
+      ++takenCount;
+    }
+  }
+  while (collection.tryPopLast(item))
+  {
+    takenSum += item;
+    ++takenCount;
+  }
+
+  for (auto& thief : thieves)
+    thief.join();
+
+  BOOST_CHECK_EQUAL(takenCount.load(), itemCount);
+  BOOST_CHECK_EQUAL(takenSum.load(), itemCount * (itemCount + 1) / 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()